@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "offline_compiler/batch_compiler.h"
+
+#include "elf/writer.h"
+#include "runtime/helpers/file_io.h"
+#include "runtime/os_interface/os_library.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+namespace OCLRT {
+
+namespace {
+class BatchCompilationJob : public OfflineCompiler {
+  public:
+    void compile(size_t numArgs, const char *const *argv, std::shared_ptr<CompilerLibraries> libraries, BatchCompilationResult &result) {
+        compilerLibraries = std::move(libraries);
+        result.retVal = initialize(numArgs, argv);
+        if (result.retVal == CL_SUCCESS) {
+            result.retVal = buildSourceCode();
+        }
+        if (result.retVal == CL_SUCCESS && generateElfBinary()) {
+            result.elfBinary.assign(elfBinary.begin(), elfBinary.begin() + elfBinarySize);
+        }
+        result.familyNameWithType = familyNameWithType;
+        result.buildLog = buildLog;
+    }
+
+    static std::string getInputFileTrunk(std::string inputFile) {
+        return getFileNameTrunk(inputFile);
+    }
+};
+
+std::string escapeJsonString(const std::string &text) {
+    std::string escaped;
+    for (auto character : text) {
+        if (character == '"' || character == '\\') {
+            escaped += '\\';
+        }
+        escaped += character;
+    }
+    return escaped;
+}
+
+std::string trimWhitespaces(const std::string &text) {
+    auto begin = text.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    auto end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+} // namespace
+
+int BatchCompiler::validateInput(size_t numArgs, const char *const *argv) {
+    int retVal = CL_SUCCESS;
+
+    for (size_t argIndex = 2; argIndex < numArgs && retVal == CL_SUCCESS; argIndex++) {
+        const char *arg = argv[argIndex];
+        bool hasValue = argIndex + 1 < numArgs;
+        if (!strcmp(arg, "-inputs") && hasValue) {
+            retVal = readInputsList(argv[++argIndex]);
+        } else if (!strcmp(arg, "-devices") && hasValue) {
+            std::stringstream devicesList(argv[++argIndex]);
+            std::string device;
+            while (std::getline(devicesList, device, ',')) {
+                if (!device.empty()) {
+                    devices.push_back(device);
+                }
+            }
+        } else if (!strcmp(arg, "-threads") && hasValue) {
+            threadsCount = static_cast<uint32_t>(std::max(0, atoi(argv[++argIndex])));
+        } else if (!strcmp(arg, "-out_dir") && hasValue) {
+            outputDirectory = argv[++argIndex];
+        } else if (!strcmp(arg, "-file") || !strcmp(arg, "-device") || !strcmp(arg, "-output")) {
+            printf("Error: %s is not supported in batch mode, use -inputs and -devices.\n", arg);
+            retVal = INVALID_COMMAND_LINE;
+        } else if (!strcmp(arg, "-?") || !strcmp(arg, "--help")) {
+            printUsage();
+            retVal = PRINT_USAGE;
+        } else {
+            // remaining options apply to every compilation of the batch
+            if (!strcmp(arg, "-q")) {
+                quiet = true;
+            }
+            forwardedArgs.push_back(arg);
+            if ((!strcmp(arg, "-options") || !strcmp(arg, "-internal_options")) && hasValue) {
+                forwardedArgs.push_back(argv[++argIndex]);
+            }
+        }
+    }
+
+    if (retVal == CL_SUCCESS) {
+        if (inputs.empty()) {
+            printf("Error: No inputs to compile, provide a list with -inputs.\n");
+            printUsage();
+            retVal = INVALID_COMMAND_LINE;
+        } else if (devices.empty()) {
+            printf("Error: Device names missing, provide them with -devices.\n");
+            printUsage();
+            retVal = INVALID_COMMAND_LINE;
+        }
+    }
+    return retVal;
+}
+
+int BatchCompiler::readInputsList(const std::string &listFile) {
+    std::ifstream list(listFile);
+    if (!list.good()) {
+        printf("Error: Inputs list %s missing.\n", listFile.c_str());
+        return INVALID_FILE;
+    }
+
+    // outputs are named after the input file trunk, inputs sharing it would overwrite each other's outputs
+    std::map<std::string, std::string> inputsByTrunk;
+    std::string line;
+    while (std::getline(list, line)) {
+        auto input = trimWhitespaces(line);
+        if (input.empty() || input[0] == '#') {
+            continue;
+        }
+        auto trunk = BatchCompilationJob::getInputFileTrunk(input);
+        auto previousInput = inputsByTrunk.find(trunk);
+        if (previousInput != inputsByTrunk.end()) {
+            printf("Error: Inputs %s and %s have the same file name %s, their outputs would overwrite each other.\n",
+                   previousInput->second.c_str(), input.c_str(), trunk.c_str());
+            return INVALID_COMMAND_LINE;
+        }
+        inputsByTrunk[trunk] = input;
+        inputs.push_back(input);
+    }
+    return CL_SUCCESS;
+}
+
+int BatchCompiler::compile() {
+    compilerLibraries = std::make_shared<CompilerLibraries>();
+    int retVal = compilerLibraries->load();
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    compileJobs();
+
+    for (size_t inputIndex = 0; inputIndex < inputs.size(); inputIndex++) {
+        auto inputRetVal = writeOutInput(inputIndex);
+        if (retVal == CL_SUCCESS) {
+            retVal = inputRetVal;
+        }
+    }
+    return retVal;
+}
+
+void BatchCompiler::compileJobs() {
+    results.clear();
+    results.resize(inputs.size() * devices.size());
+
+    size_t workersCount = threadsCount != 0 ? threadsCount : std::max(1u, std::thread::hardware_concurrency());
+    workersCount = std::min(workersCount, results.size());
+
+    std::atomic<size_t> nextJob{0};
+    auto worker = [&]() {
+        for (auto jobIndex = nextJob++; jobIndex < results.size(); jobIndex = nextJob++) {
+            auto &input = inputs[jobIndex / devices.size()];
+            auto &device = devices[jobIndex % devices.size()];
+
+            std::vector<const char *> args = {"ocloc", "-file", input.c_str(), "-device", device.c_str()};
+            for (auto &arg : forwardedArgs) {
+                args.push_back(arg.c_str());
+            }
+
+            BatchCompilationJob job;
+            job.compile(args.size(), args.data(), compilerLibraries, results[jobIndex]);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t workerIndex = 1; workerIndex < workersCount; workerIndex++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &workerThread : workers) {
+        workerThread.join();
+    }
+}
+
+int BatchCompiler::writeOutInput(size_t inputIndex) {
+    int retVal = CL_SUCCESS;
+    auto &input = inputs[inputIndex];
+    auto fileTrunk = BatchCompilationJob::getInputFileTrunk(input);
+    auto fatBinaryFile = generateFilePath(outputDirectory, fileTrunk, ".fatbin");
+
+    CLElfLib::CElfWriter elfWriter(CLElfLib::E_EH_TYPE::EH_TYPE_NONE, CLElfLib::E_EH_MACHINE::EH_MACHINE_NONE, 0);
+    bool anyBinary = false;
+
+    std::ostringstream manifest;
+    manifest << "{\n";
+    manifest << "  \"input\": \"" << escapeJsonString(input) << "\",\n";
+    manifest << "  \"binary\": \"" << escapeJsonString(fatBinaryFile) << "\",\n";
+    manifest << "  \"devices\": [";
+
+    for (size_t deviceIndex = 0; deviceIndex < devices.size(); deviceIndex++) {
+        auto &device = devices[deviceIndex];
+        auto &result = results[inputIndex * devices.size() + deviceIndex];
+
+        if (!result.buildLog.empty()) {
+            printf("%s\n", result.buildLog.c_str());
+        }
+        if (result.retVal == CL_SUCCESS) {
+            if (!quiet) {
+                printf("Build of %s for %s succeeded.\n", input.c_str(), device.c_str());
+            }
+        } else {
+            printf("Build of %s for %s failed with error code: %d\n", input.c_str(), device.c_str(), result.retVal);
+            if (retVal == CL_SUCCESS) {
+                retVal = result.retVal;
+            }
+        }
+
+        if (!result.elfBinary.empty()) {
+            auto binarySize = static_cast<uint32_t>(result.elfBinary.size());
+            elfWriter.addSection(CLElfLib::SSectionNode(CLElfLib::E_SH_TYPE::SH_TYPE_PROG_BITS, CLElfLib::E_SH_FLAG::SH_FLAG_NONE, device,
+                                                        std::string(result.elfBinary.begin(), result.elfBinary.end()), binarySize));
+            anyBinary = true;
+        }
+
+        manifest << (deviceIndex == 0 ? "\n" : ",\n");
+        manifest << "    {\"device\": \"" << escapeJsonString(device) << "\", ";
+        manifest << "\"family\": \"" << escapeJsonString(result.familyNameWithType) << "\", ";
+        manifest << "\"retVal\": " << result.retVal << ", ";
+        manifest << "\"section\": \"" << (result.elfBinary.empty() ? "" : escapeJsonString(device)) << "\", ";
+        manifest << "\"size\": " << result.elfBinary.size() << "}";
+    }
+    manifest << "\n  ]\n}\n";
+
+    if (outputDirectory != "") {
+        createDirectoryTree(outputDirectory);
+    }
+
+    if (anyBinary) {
+        CLElfLib::ElfBinaryStorage fatBinary(elfWriter.getTotalBinarySize());
+        elfWriter.resolveBinary(fatBinary);
+        writeDataToFile(fatBinaryFile.c_str(), fatBinary.data(), fatBinary.size());
+    }
+
+    auto manifestString = manifest.str();
+    auto manifestFile = generateFilePath(outputDirectory, fileTrunk, ".manifest.json");
+    writeDataToFile(manifestFile.c_str(), manifestString.c_str(), manifestString.size());
+
+    return retVal;
+}
+
+void BatchCompiler::printUsage() {
+    printf("Compiles a list of CL files for a list of devices, loading the compiler once\n");
+    printf("and compiling on multiple threads. For each input a fat binary (<input>.fatbin, ELF\n");
+    printf("with one section per device) and a manifest (<input>.manifest.json) are created.\n\n");
+    printf("ocloc batch -inputs <list_file> -devices <device_type>[,<device_type>...] [OPTIONS]\n\n");
+    printf("  -inputs <list_file>          File with paths of CL files to be compiled, one per line.\n");
+    printf("                               File names of the inputs have to be unique.\n");
+    printf("  -devices <device_types>      Comma separated list of devices to compile for.\n");
+    printf("  -threads <count>             Number of compiler threads, defaults to number of CPUs.\n");
+    printf("  -out_dir <output_dir>        Indicates the directory into which the fat binaries\n");
+    printf("                               and manifests will be placed.\n");
+    printf("\n");
+    printf("  Other ocloc options (e.g. -options, -internal_options, -32, -64, -q) are applied\n");
+    printf("  to every compilation.\n");
+}
+} // namespace OCLRT
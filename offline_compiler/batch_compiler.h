@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "offline_compiler/offline_compiler.h"
+
+#include "CL/cl.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+
+struct BatchCompilationResult {
+    int retVal = CL_SUCCESS;
+    std::string familyNameWithType;
+    std::string buildLog;
+    std::vector<char> elfBinary;
+};
+
+// Compiles a list of inputs for a list of devices within a single process. Compiler libraries
+// are loaded once, compilations run on a pool of threads and all device binaries of an input
+// are packed into one fat binary (ELF with a section per device) described by a manifest.
+class BatchCompiler {
+  public:
+    int validateInput(size_t numArgs, const char *const *argv);
+    int compile();
+
+    const std::vector<std::string> &getInputs() const { return inputs; }
+    const std::vector<std::string> &getDevices() const { return devices; }
+    const std::vector<BatchCompilationResult> &getResults() const { return results; }
+
+  protected:
+    int readInputsList(const std::string &listFile);
+    void compileJobs();
+    int writeOutInput(size_t inputIndex);
+    void printUsage();
+
+    std::vector<std::string> inputs;
+    std::vector<std::string> devices;
+    std::vector<std::string> forwardedArgs;
+    std::string outputDirectory;
+    uint32_t threadsCount = 0;
+    bool quiet = false;
+
+    std::shared_ptr<CompilerLibraries> compilerLibraries;
+    std::vector<BatchCompilationResult> results;
+};
+} // namespace OCLRT
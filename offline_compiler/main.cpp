@@ -5,14 +5,19 @@
  *
  */
 
+#include "offline_compiler/batch_compiler.h"
 #include "offline_compiler/offline_compiler.h"
 #include "offline_compiler/utilities/safety_caller.h"
 #include "runtime/os_interface/os_library.h"
+#include "runtime/utilities/binary_log.h"
 
 #include "decoder/binary_decoder.h"
 #include "decoder/binary_encoder.h"
 #include <CL/cl.h>
 
+#include <fstream>
+#include <iostream>
+
 using namespace OCLRT;
 
 int main(int numArgs, const char *argv[]) {
@@ -33,6 +38,25 @@ int main(int numArgs, const char *argv[]) {
             } else {
                 return retVal;
             }
+        } else if (numArgs > 1 && !strcmp(argv[1], "batch")) { // -inputs list.txt -devices skl,kbl -threads 8
+            BatchCompiler batch;
+            int retVal = batch.validateInput(numArgs, argv);
+            if (retVal == 0) {
+                return batch.compile();
+            } else {
+                return retVal;
+            }
+        } else if (numArgs > 1 && !strcmp(argv[1], "decode_log")) { // igdrcl.log.bin
+            if (numArgs != 3) {
+                printf("Usage: ocloc decode_log <binary log file>\n");
+                return -1;
+            }
+            std::ifstream binaryLog(argv[2], std::ios::binary);
+            if (!binaryLog.good() || !BinaryLogDecoder::decode(binaryLog, std::cout)) {
+                printf("Error: %s is not a valid binary log\n", argv[2]);
+                return -1;
+            }
+            return 0;
         } else {
             int retVal = CL_SUCCESS;
             OfflineCompiler *pCompiler = OfflineCompiler::create(numArgs, argv, retVal);
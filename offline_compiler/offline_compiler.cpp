@@ -126,9 +126,9 @@ int OfflineCompiler::buildSourceCode() {
         if (false == inputIsIntermediateRepresentation) {
             IGC::CodeType::CodeType_t intermediateRepresentation = useLlvmText ? IGC::CodeType::llvmLl : preferredIntermediateRepresentation;
             // sourceCode.size() returns the number of characters without null terminated char
-            auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), sourceCode.c_str(), sourceCode.size() + 1);
-            auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), options.c_str(), options.size());
-            auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), internalOptions.c_str(), internalOptions.size());
+            auto fclSrc = CIF::Builtins::CreateConstBuffer(compilerLibraries->fclMain.get(), sourceCode.c_str(), sourceCode.size() + 1);
+            auto fclOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->fclMain.get(), options.c_str(), options.size());
+            auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->fclMain.get(), internalOptions.c_str(), internalOptions.size());
 
             auto fclTranslationCtx = fclDeviceCtx->CreateTranslationCtx(IGC::CodeType::oclC, intermediateRepresentation);
             auto igcTranslationCtx = igcDeviceCtx->CreateTranslationCtx(intermediateRepresentation, IGC::CodeType::oclGenBin);
@@ -165,9 +165,9 @@ int OfflineCompiler::buildSourceCode() {
                                                      nullptr, 0);
 
         } else {
-            auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), sourceCode.c_str(), sourceCode.size());
-            auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
-            auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), internalOptions.c_str(), internalOptions.size());
+            auto igcSrc = CIF::Builtins::CreateConstBuffer(compilerLibraries->igcMain.get(), sourceCode.c_str(), sourceCode.size());
+            auto igcOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->igcMain.get(), nullptr, 0);
+            auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(compilerLibraries->igcMain.get(), internalOptions.c_str(), internalOptions.size());
             auto igcTranslationCtx = igcDeviceCtx->CreateTranslationCtx(inputFileSpirV ? IGC::CodeType::spirV : IGC::CodeType::llvmBc, IGC::CodeType::oclGenBin);
             igcOutput = igcTranslationCtx->Translate(igcSrc.get(), igcOptions.get(), igcInternalOptions.get(), nullptr, 0);
         }
@@ -327,34 +327,18 @@ int OfflineCompiler::initialize(size_t numArgs, const char *const *argv) {
         sourceCode = (pSource != nullptr) ? getStringWithinDelimiters((char *)pSourceFromFile) : (char *)pSourceFromFile;
     }
 
-    auto fclLibFile = OsLibrary::load(Os::frontEndDllName);
-    if (fclLibFile == nullptr) {
-        printf("Error: Failed to load %s\n", Os::frontEndDllName);
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->fclLib.reset(fclLibFile);
-    if (this->fclLib == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    auto fclCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->fclLib->getProcAddress(CIF::CreateCIFMainFuncName));
-    if (fclCreateMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
+    if (this->compilerLibraries == nullptr) {
+        this->compilerLibraries = std::make_shared<CompilerLibraries>();
+        retVal = this->compilerLibraries->load();
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
     }
 
-    this->fclMain = CIF::RAII::UPtr(createMainNoSanitize(fclCreateMain));
-    if (this->fclMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
+    // libraries may be shared with compilations running on other threads
+    std::lock_guard<std::mutex> deviceContextsLock(compilerLibraries->deviceContextsMutex);
 
-    if (false == this->fclMain->IsCompatible<IGC::FclOclDeviceCtx>()) {
-        // given FCL is not compatible
-        DEBUG_BREAK_IF(true);
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->fclDeviceCtx = this->fclMain->CreateInterface<IGC::FclOclDeviceCtxTagOCL>();
+    this->fclDeviceCtx = compilerLibraries->fclMain->CreateInterface<IGC::FclOclDeviceCtxTagOCL>();
     if (this->fclDeviceCtx == nullptr) {
         return CL_OUT_OF_HOST_MEMORY;
     }
@@ -362,28 +346,7 @@ int OfflineCompiler::initialize(size_t numArgs, const char *const *argv) {
     fclDeviceCtx->SetOclApiVersion(hwInfo->capabilityTable.clVersionSupport * 10);
     preferredIntermediateRepresentation = fclDeviceCtx->GetPreferredIntermediateRepresentation();
 
-    this->igcLib.reset(OsLibrary::load(Os::igcDllName));
-    if (this->igcLib == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    auto igcCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->igcLib->getProcAddress(CIF::CreateCIFMainFuncName));
-    if (igcCreateMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->igcMain = CIF::RAII::UPtr(createMainNoSanitize(igcCreateMain));
-    if (this->igcMain == nullptr) {
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    if (false == this->igcMain->IsCompatible<IGC::IgcOclDeviceCtx>()) {
-        // given IGC is not compatible
-        DEBUG_BREAK_IF(true);
-        return CL_OUT_OF_HOST_MEMORY;
-    }
-
-    this->igcDeviceCtx = this->igcMain->CreateInterface<IGC::IgcOclDeviceCtxTagOCL>();
+    this->igcDeviceCtx = compilerLibraries->igcMain->CreateInterface<IGC::IgcOclDeviceCtxTagOCL>();
     if (this->igcDeviceCtx == nullptr) {
         return CL_OUT_OF_HOST_MEMORY;
     }
@@ -431,6 +394,65 @@ int OfflineCompiler::initialize(size_t numArgs, const char *const *argv) {
     return retVal;
 }
 
+CompilerLibraries::CompilerLibraries() = default;
+
+CompilerLibraries::~CompilerLibraries() = default;
+
+////////////////////////////////////////////////////////////////////////////////
+// CompilerLibraries::load
+////////////////////////////////////////////////////////////////////////////////
+int CompilerLibraries::load() {
+    auto fclLibFile = OsLibrary::load(Os::frontEndDllName);
+    if (fclLibFile == nullptr) {
+        printf("Error: Failed to load %s\n", Os::frontEndDllName);
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->fclLib.reset(fclLibFile);
+    if (this->fclLib == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    auto fclCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->fclLib->getProcAddress(CIF::CreateCIFMainFuncName));
+    if (fclCreateMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->fclMain = CIF::RAII::UPtr(createMainNoSanitize(fclCreateMain));
+    if (this->fclMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    if (false == this->fclMain->IsCompatible<IGC::FclOclDeviceCtx>()) {
+        // given FCL is not compatible
+        DEBUG_BREAK_IF(true);
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->igcLib.reset(OsLibrary::load(Os::igcDllName));
+    if (this->igcLib == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    auto igcCreateMain = reinterpret_cast<CIF::CreateCIFMainFunc_t>(this->igcLib->getProcAddress(CIF::CreateCIFMainFuncName));
+    if (igcCreateMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    this->igcMain = CIF::RAII::UPtr(createMainNoSanitize(igcCreateMain));
+    if (this->igcMain == nullptr) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    if (false == this->igcMain->IsCompatible<IGC::IgcOclDeviceCtx>()) {
+        // given IGC is not compatible
+        DEBUG_BREAK_IF(true);
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
+    return CL_SUCCESS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // ParseCommandLine
 ////////////////////////////////////////////////////////////////////////////////
@@ -723,20 +745,7 @@ void OfflineCompiler::writeOutAllFiles() {
     }
 
     if (outputDirectory != "") {
-        std::list<std::string> dirList;
-        std::string tmp = outputDirectory;
-        size_t pos = outputDirectory.size() + 1;
-
-        do {
-            dirList.push_back(tmp);
-            pos = tmp.find_last_of("/\\", pos);
-            tmp = tmp.substr(0, pos);
-        } while (pos != std::string::npos);
-
-        while (!dirList.empty()) {
-            MakeDirectory(dirList.back().c_str());
-            dirList.pop_back();
-        }
+        createDirectoryTree(outputDirectory);
     }
 
     if (irBinary) {
@@ -807,6 +816,23 @@ bool OfflineCompiler::readOptionsFromFile(std::string &options, const std::strin
     return true;
 }
 
+void createDirectoryTree(const std::string &directory) {
+    std::list<std::string> dirList;
+    std::string tmp = directory;
+    size_t pos = directory.size() + 1;
+
+    do {
+        dirList.push_back(tmp);
+        pos = tmp.find_last_of("/\\", pos);
+        tmp = tmp.substr(0, pos);
+    } while (pos != std::string::npos);
+
+    while (!dirList.empty()) {
+        MakeDirectory(dirList.back().c_str());
+        dirList.pop_back();
+    }
+}
+
 std::string generateFilePath(const std::string &directory, const std::string &fileNameBase, const char *extension) {
     UNRECOVERABLE_IF(extension == nullptr);
 
@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace OCLRT {
@@ -30,6 +31,23 @@ enum ErrorCode {
 };
 
 std::string generateFilePath(const std::string &directory, const std::string &fileNameBase, const char *extension);
+void createDirectoryTree(const std::string &directory);
+
+// Front end and IGC libraries, in batch mode loaded once and shared by all compilations
+struct CompilerLibraries {
+    CompilerLibraries();
+    ~CompilerLibraries();
+
+    int load();
+
+    std::unique_ptr<OsLibrary> fclLib = nullptr;
+    CIF::RAII::UPtr_t<CIF::CIFMain> fclMain = nullptr;
+
+    std::unique_ptr<OsLibrary> igcLib = nullptr;
+    CIF::RAII::UPtr_t<CIF::CIFMain> igcMain = nullptr;
+
+    std::mutex deviceContextsMutex;
+};
 
 class OfflineCompiler {
   public:
@@ -53,7 +71,7 @@ class OfflineCompiler {
     OfflineCompiler();
 
     int getHardwareInfo(const char *pDeviceName);
-    std::string getFileNameTrunk(std::string &filePath);
+    static std::string getFileNameTrunk(std::string &filePath);
     std::string getStringWithinDelimiters(const std::string &src);
     int initialize(size_t numArgs, const char *const *argv);
     int parseCommandLine(size_t numArgs, const char *const *argv);
@@ -103,12 +121,8 @@ class OfflineCompiler {
     char *debugDataBinary = nullptr;
     size_t debugDataBinarySize = 0;
 
-    std::unique_ptr<OsLibrary> igcLib = nullptr;
-    CIF::RAII::UPtr_t<CIF::CIFMain> igcMain = nullptr;
+    std::shared_ptr<CompilerLibraries> compilerLibraries = nullptr;
     CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL> igcDeviceCtx = nullptr;
-
-    std::unique_ptr<OsLibrary> fclLib = nullptr;
-    CIF::RAII::UPtr_t<CIF::CIFMain> fclMain = nullptr;
     CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL> fclDeviceCtx = nullptr;
     IGC::CodeType::CodeType_t preferredIntermediateRepresentation;
 };
@@ -12,6 +12,7 @@
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
 #include "runtime/device_queue/device_queue.h"
+#include "runtime/event/completion_dispatcher.h"
 #include "runtime/event/event_builder.h"
 #include "runtime/event/user_event.h"
 #include "runtime/gtpin/gtpin_notify.h"
@@ -35,6 +36,7 @@
 
 #include "CL/cl_ext.h"
 
+#include <algorithm>
 #include <map>
 
 namespace OCLRT {
@@ -99,6 +101,7 @@ CommandQueue::~CommandQueue() {
     }
 
     timestampPacketContainer.reset();
+    kernelOperationsPool.clear();
     //for normal queue, decrement ref count on context
     //special queue is owned by context so ref count doesn't have to be decremented
     if (context && !isSpecialCommandQueue) {
@@ -135,8 +138,10 @@ void CommandQueue::waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushS
 
     getCommandStreamReceiver().waitForTaskCountWithKmdNotifyFallback(taskCountToWait, flushStampToWait, useQuickKmdSleep, forcePowerSavingMode);
 
-    DEBUG_BREAK_IF(getHwTag() < taskCountToWait);
+    auto hwTag = getHwTag();
+    DEBUG_BREAK_IF(hwTag < taskCountToWait);
     latestTaskCountWaited = taskCountToWait;
+    getCommandStreamReceiver().getCompletionDispatcher().dispatch(hwTag);
     WAIT_LEAVE()
 }
 
@@ -529,6 +534,59 @@ void CommandQueue::releaseIndirectHeap(IndirectHeap::Type heapType) {
     getCommandStreamReceiver().releaseIndirectHeap(heapType);
 }
 
+KernelOperation *CommandQueue::obtainKernelOperation(size_t commandStreamSize, size_t additionalAllocationSize,
+                                                     size_t dshSize, size_t iohSize, size_t sshSize) {
+    auto &commandStreamReceiver = getCommandStreamReceiver();
+    std::unique_ptr<KernelOperation> kernelOperation;
+    {
+        // resources of a pooled operation may still be used by GPU until its task count is reached
+        auto completedTaskCount = *commandStreamReceiver.getTagAddress();
+        std::lock_guard<std::mutex> lock(kernelOperationsPoolMutex);
+        auto completedOperation = std::find_if(kernelOperationsPool.begin(), kernelOperationsPool.end(), [completedTaskCount](const std::unique_ptr<KernelOperation> &pooledOperation) {
+            return pooledOperation->taskCount <= completedTaskCount;
+        });
+        if (completedOperation != kernelOperationsPool.end()) {
+            kernelOperation = std::move(*completedOperation);
+            kernelOperationsPool.erase(completedOperation);
+        }
+    }
+
+    if (!kernelOperation) {
+        using UniqueIH = std::unique_ptr<IndirectHeap>;
+        IndirectHeap *dsh = nullptr, *ioh = nullptr, *ssh = nullptr;
+        commandStreamReceiver.allocateHeapMemory(IndirectHeap::DYNAMIC_STATE, dshSize, dsh);
+        commandStreamReceiver.allocateHeapMemory(IndirectHeap::INDIRECT_OBJECT, iohSize, ioh);
+        commandStreamReceiver.allocateHeapMemory(IndirectHeap::SURFACE_STATE, sshSize, ssh);
+        auto commandStream = std::make_unique<LinearStream>();
+        commandStreamReceiver.ensureCommandBufferAllocation(*commandStream, commandStreamSize, additionalAllocationSize);
+        return new KernelOperation(std::move(commandStream), UniqueIH(dsh), UniqueIH(ioh), UniqueIH(ssh),
+                                   *commandStreamReceiver.getInternalAllocationStorage());
+    }
+
+    auto &commandStream = *kernelOperation->commandStream;
+    commandStream.replaceBuffer(commandStream.getCpuBase(), commandStream.getMaxAvailableSpace());
+    commandStreamReceiver.ensureCommandBufferAllocation(commandStream, commandStreamSize, additionalAllocationSize);
+    commandStreamReceiver.reuseHeapMemory(IndirectHeap::DYNAMIC_STATE, dshSize, *kernelOperation->dsh);
+    commandStreamReceiver.reuseHeapMemory(IndirectHeap::INDIRECT_OBJECT, iohSize, *kernelOperation->ioh);
+    commandStreamReceiver.reuseHeapMemory(IndirectHeap::SURFACE_STATE, sshSize, *kernelOperation->ssh);
+    kernelOperation->surfaceStateHeapSizeEM = 0;
+    kernelOperation->taskCount = 0u;
+    return kernelOperation.release();
+}
+
+void CommandQueue::releaseKernelOperation(std::unique_ptr<KernelOperation> kernelOperation) {
+    bool canBePooled = !kernelOperation->doNotFreeISH &&
+                       kernelOperation->ioh.get() != kernelOperation->dsh.get() &&
+                       &kernelOperation->storageForAllocations == getCommandStreamReceiver().getInternalAllocationStorage();
+    if (!canBePooled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(kernelOperationsPoolMutex);
+    if (kernelOperationsPool.size() < maxPooledKernelOperations) {
+        kernelOperationsPool.push_back(std::move(kernelOperation));
+    }
+}
+
 void CommandQueue::dispatchAuxTranslation(MultiDispatchInfo &multiDispatchInfo, MemObjsForAuxTranslation &memObjsForAuxTranslation,
                                           AuxTranslationDirection auxTranslationDirection) {
     if (!multiDispatchInfo.empty()) {
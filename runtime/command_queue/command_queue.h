@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 
 namespace OCLRT {
 class Buffer;
@@ -344,6 +345,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     MOCKABLE_VIRTUAL void releaseIndirectHeap(IndirectHeap::Type heapType);
 
+    KernelOperation *obtainKernelOperation(size_t commandStreamSize, size_t additionalAllocationSize,
+                                           size_t dshSize, size_t iohSize, size_t sshSize);
+    void releaseKernelOperation(std::unique_ptr<KernelOperation> kernelOperation);
+
     void releaseVirtualEvent() {
         if (this->virtualEvent != nullptr) {
             this->virtualEvent->decRefInternal();
@@ -466,6 +471,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
 
+    static constexpr size_t maxPooledKernelOperations = 16u;
+    std::mutex kernelOperationsPoolMutex;
+    std::vector<std::unique_ptr<KernelOperation>> kernelOperationsPool;
+
   private:
     void providePerformanceHint(TransferProperties &transferProperties);
 };
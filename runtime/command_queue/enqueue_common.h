@@ -31,6 +31,7 @@
 #include "runtime/program/printf_handler.h"
 #include "runtime/utilities/range.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/timeline_tracer.h"
 
 #include "hw_cmds.h"
 
@@ -141,6 +142,8 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         return;
     }
 
+    TimelineScope timelineScope("CommandQueue::enqueueHandler", commandType);
+
     Kernel *parentKernel = multiDispatchInfo.peekParentKernel();
     auto devQueue = this->getContext().getDefaultDeviceQueue();
     DeviceQueueHw<GfxFamily> *devQueueHw = castToObject<DeviceQueueHw<GfxFamily>>(devQueue);
@@ -151,7 +154,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     TimeStampData queueTimeStamp;
     if (isProfilingEnabled() && event) {
-        this->getDevice().getOSTime()->getCpuGpuTime(&queueTimeStamp);
+        this->getDevice().getOSTime()->sampleCpuGpuTime(&queueTimeStamp);
     }
 
     EventBuilder eventBuilder;
@@ -295,7 +298,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
             if (eventBuilder.getEvent() && isProfilingEnabled()) {
                 TimeStampData submitTimeStamp;
-                this->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+                this->getDevice().getOSTime()->sampleCpuGpuTime(&submitTimeStamp);
                 eventBuilder.getEvent()->setSubmitTimeStamp(&submitTimeStamp);
                 eventBuilder.getEvent()->setSubmitTimeStamp();
                 eventBuilder.getEvent()->setStartTimeStamp();
@@ -578,7 +581,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
 
     TimeStampData submitTimeStamp;
     if (isProfilingEnabled() && eventBuilder.getEvent()) {
-        this->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+        this->getDevice().getOSTime()->sampleCpuGpuTime(&submitTimeStamp);
         eventBuilder.getEvent()->setSubmitTimeStamp(&submitTimeStamp);
         getCommandStreamReceiver().makeResident(*eventBuilder.getEvent()->getHwTimeStampNode()->getBaseGraphicsAllocation());
         if (isPerfCountersEnabled()) {
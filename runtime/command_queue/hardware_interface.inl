@@ -54,10 +54,11 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
 
         constexpr static auto additionalAllocationSize = CSRequirements::csOverfetchSize;
         constexpr static auto allocationSize = MemoryConstants::pageSize64k - additionalAllocationSize;
-        commandStream = new LinearStream();
-        commandQueue.getCommandStreamReceiver().ensureCommandBufferAllocation(*commandStream, allocationSize, additionalAllocationSize);
 
         if (parentKernel) {
+            commandStream = new LinearStream();
+            commandQueue.getCommandStreamReceiver().ensureCommandBufferAllocation(*commandStream, allocationSize, additionalAllocationSize);
+
             uint32_t colorCalcSize = commandQueue.getContext().getDefaultDeviceQueue()->colorCalcStateSize;
 
             commandQueue.allocateHeapMemory(
@@ -72,17 +73,20 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
                                                 IndirectHeap::SURFACE_STATE>(*parentKernel) +
                                                 KCH::getTotalSizeRequiredSSH(multiDispatchInfo),
                                             ssh);
-        } else {
-            commandQueue.allocateHeapMemory(IndirectHeap::DYNAMIC_STATE, KCH::getTotalSizeRequiredDSH(multiDispatchInfo), dsh);
-            commandQueue.allocateHeapMemory(IndirectHeap::INDIRECT_OBJECT, KCH::getTotalSizeRequiredIOH(multiDispatchInfo), ioh);
-            commandQueue.allocateHeapMemory(IndirectHeap::SURFACE_STATE, KCH::getTotalSizeRequiredSSH(multiDispatchInfo), ssh);
-        }
 
-        using UniqueIH = std::unique_ptr<IndirectHeap>;
-        *blockedCommandsData = new KernelOperation(std::unique_ptr<LinearStream>(commandStream), UniqueIH(dsh), UniqueIH(ioh),
-                                                   UniqueIH(ssh), *commandQueue.getCommandStreamReceiver().getInternalAllocationStorage());
-        if (parentKernel) {
+            using UniqueIH = std::unique_ptr<IndirectHeap>;
+            *blockedCommandsData = new KernelOperation(std::unique_ptr<LinearStream>(commandStream), UniqueIH(dsh), UniqueIH(ioh),
+                                                       UniqueIH(ssh), *commandQueue.getCommandStreamReceiver().getInternalAllocationStorage());
             (*blockedCommandsData)->doNotFreeISH = true;
+        } else {
+            *blockedCommandsData = commandQueue.obtainKernelOperation(allocationSize, additionalAllocationSize,
+                                                                      KCH::getTotalSizeRequiredDSH(multiDispatchInfo),
+                                                                      KCH::getTotalSizeRequiredIOH(multiDispatchInfo),
+                                                                      KCH::getTotalSizeRequiredSSH(multiDispatchInfo));
+            commandStream = (*blockedCommandsData)->commandStream.get();
+            dsh = (*blockedCommandsData)->dsh.get();
+            ioh = (*blockedCommandsData)->ioh.get();
+            ssh = (*blockedCommandsData)->ssh.get();
         }
     } else {
         commandStream = &commandQueue.getCS(0);
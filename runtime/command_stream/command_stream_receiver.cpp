@@ -11,6 +11,7 @@
 #include "runtime/command_stream/experimental_command_buffer.h"
 #include "runtime/command_stream/preemption.h"
 #include "runtime/command_stream/scratch_space_controller.h"
+#include "runtime/event/completion_dispatcher.h"
 #include "runtime/event/event.h"
 #include "runtime/gtpin/gtpin_notify.h"
 #include "runtime/helpers/array_count.h"
@@ -35,6 +36,9 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 
     latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     submissionAggregator.reset(new SubmissionAggregator());
+    if (DebugManager.flags.BatchedSubmissionTargetLatencyUs.get() > 0) {
+        submissionAggregator->setTargetSubmissionLatency(DebugManager.flags.BatchedSubmissionTargetLatencyUs.get());
+    }
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
@@ -43,6 +47,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
         indirectHeap[i] = nullptr;
     }
     internalAllocationStorage = std::make_unique<InternalAllocationStorage>(*this);
+    completionDispatcher = std::make_unique<CompletionDispatcher>();
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
@@ -259,13 +264,14 @@ IndirectHeap &CommandStreamReceiver::getIndirectHeap(IndirectHeap::Type heapType
     if (heap)
         heapMemory = heap->getGraphicsAllocation();
 
-    if (heap && heap->getAvailableSpace() < minRequiredSize && heapMemory) {
+    if (heap && heapMemory && !reserveHeapSpace(heapType, *heap, minRequiredSize)) {
         internalAllocationStorage->storeAllocation(std::unique_ptr<GraphicsAllocation>(heapMemory), REUSABLE_ALLOCATION);
         heapMemory = nullptr;
     }
 
     if (!heapMemory) {
         allocateHeapMemory(heapType, minRequiredSize, heap);
+        heapRings[heapType].reset(heap->getUsed());
     }
 
     return *heap;
@@ -314,6 +320,44 @@ void CommandStreamReceiver::allocateHeapMemory(IndirectHeap::Type heapType,
     scratchSpaceController->reserveHeap(heapType, indirectHeap);
 }
 
+void CommandStreamReceiver::reuseHeapMemory(IndirectHeap::Type heapType, size_t minRequiredSize, IndirectHeap &indirectHeap) {
+    auto heapMemory = indirectHeap.getGraphicsAllocation();
+    auto heap = &indirectHeap;
+    if (heapMemory && indirectHeap.getMaxAvailableSpace() >= minRequiredSize) {
+        indirectHeap.replaceBuffer(indirectHeap.getCpuBase(), indirectHeap.getMaxAvailableSpace());
+        scratchSpaceController->reserveHeap(heapType, heap);
+        return;
+    }
+    if (heapMemory) {
+        internalAllocationStorage->storeAllocation(std::unique_ptr<GraphicsAllocation>(heapMemory), REUSABLE_ALLOCATION);
+    }
+    allocateHeapMemory(heapType, minRequiredSize, heap);
+}
+
+bool CommandStreamReceiver::reserveHeapSpace(IndirectHeap::Type heapType, IndirectHeap &heap, size_t minRequiredSize) {
+    if (DebugManager.flags.EnableIndirectHeapRing.get() == 0) {
+        return heap.getAvailableSpace() >= minRequiredSize;
+    }
+    auto lap = heapRings[heapType].peekLap();
+    if (!heapRings[heapType].reserveSpace(heap, minRequiredSize, tagAddress ? *tagAddress : 0u)) {
+        return false;
+    }
+    if (lap != heapRings[heapType].peekLap()) {
+        heapWrapsCount++;
+        heapWrapInvalidationRequired = true;
+    }
+    return true;
+}
+
+void CommandStreamReceiver::recordHeapsUsage(uint32_t submittedTaskCount) {
+    auto completedTaskCount = tagAddress ? *tagAddress : 0u;
+    for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
+        if (indirectHeap[i] && indirectHeap[i]->getGraphicsAllocation()) {
+            heapRings[i].recordSubmission(*indirectHeap[i], submittedTaskCount, completedTaskCount);
+        }
+    }
+}
+
 void CommandStreamReceiver::releaseIndirectHeap(IndirectHeap::Type heapType) {
     DEBUG_BREAK_IF(static_cast<uint32_t>(heapType) >= arrayCount(indirectHeap));
     auto &heap = indirectHeap[heapType];
@@ -325,6 +369,7 @@ void CommandStreamReceiver::releaseIndirectHeap(IndirectHeap::Type heapType) {
         heap->replaceBuffer(nullptr, 0);
         heap->replaceGraphicsAllocation(nullptr);
     }
+    heapRings[heapType].reset(0u);
 }
 
 void CommandStreamReceiver::setExperimentalCmdBuffer(std::unique_ptr<ExperimentalCommandBuffer> &&cmdBuffer) {
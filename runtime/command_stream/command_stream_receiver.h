@@ -16,6 +16,7 @@
 #include "runtime/helpers/flat_batch_buffer_helper.h"
 #include "runtime/helpers/options.h"
 #include "runtime/indirect_heap/indirect_heap.h"
+#include "runtime/indirect_heap/indirect_heap_ring.h"
 #include "runtime/kernel/grf_config.h"
 
 #include <cstddef>
@@ -23,6 +24,7 @@
 
 namespace OCLRT {
 class AllocationsList;
+class CompletionDispatcher;
 class Device;
 class EventBuilder;
 class ExecutionEnvironment;
@@ -112,6 +114,9 @@ class CommandStreamReceiver {
 
     uint32_t peekLatestFlushedTaskCount() const { return latestFlushedTaskCount; }
 
+    uint64_t peekHeapWrapsCount() const { return heapWrapsCount; }
+    uint64_t peekStateBaseAddressProgrammingsCount() const { return stateBaseAddressProgrammingsCount; }
+
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
@@ -142,6 +147,7 @@ class CommandStreamReceiver {
     IndirectHeap &getIndirectHeap(IndirectHeap::Type heapType, size_t minRequiredSize);
     void allocateHeapMemory(IndirectHeap::Type heapType, size_t minRequiredSize, IndirectHeap *&indirectHeap);
     void releaseIndirectHeap(IndirectHeap::Type heapType);
+    void reuseHeapMemory(IndirectHeap::Type heapType, size_t minRequiredSize, IndirectHeap &indirectHeap);
 
     virtual enum CommandStreamReceiverType getType() = 0;
     void setExperimentalCmdBuffer(std::unique_ptr<ExperimentalCommandBuffer> &&cmdBuffer);
@@ -161,6 +167,7 @@ class CommandStreamReceiver {
     AllocationsList &getTemporaryAllocations();
     AllocationsList &getAllocationsForReuse();
     InternalAllocationStorage *getInternalAllocationStorage() const { return internalAllocationStorage.get(); }
+    CompletionDispatcher &getCompletionDispatcher() const { return *completionDispatcher; }
     bool createAllocationForHostSurface(HostPtrSurface &surface, bool requiresL3Flush);
     virtual size_t getPreferredTagPoolSize() const { return 512; }
     virtual void setupContext(OsContext &osContext) { this->osContext = &osContext; }
@@ -183,12 +190,15 @@ class CommandStreamReceiver {
 
   protected:
     void cleanupResources();
+    bool reserveHeapSpace(IndirectHeap::Type heapType, IndirectHeap &heap, size_t minRequiredSize);
+    void recordHeapsUsage(uint32_t submittedTaskCount);
 
     std::unique_ptr<FlushStampTracker> flushStamp;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
     std::unique_ptr<FlatBatchBufferHelper> flatBatchBufferHelper;
     std::unique_ptr<ExperimentalCommandBuffer> experimentalCmdBuffer;
     std::unique_ptr<InternalAllocationStorage> internalAllocationStorage;
+    std::unique_ptr<CompletionDispatcher> completionDispatcher;
     std::unique_ptr<KmdNotifyHelper> kmdNotifyHelper;
     std::unique_ptr<ScratchSpaceController> scratchSpaceController;
     std::unique_ptr<TagAllocator<HwTimeStamps>> profilingTimeStampAllocator;
@@ -210,6 +220,7 @@ class CommandStreamReceiver {
     OSInterface *osInterface = nullptr;
 
     IndirectHeap *indirectHeap[IndirectHeap::NUM_TYPES];
+    IndirectHeapRing heapRings[IndirectHeap::NUM_TYPES];
 
     // current taskLevel.  Used for determining if a PIPE_CONTROL is needed.
     std::atomic<uint32_t> taskLevel{0};
@@ -221,6 +232,8 @@ class CommandStreamReceiver {
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
     uint64_t totalMemoryUsed = 0u;
+    uint64_t heapWrapsCount = 0u;
+    uint64_t stateBaseAddressProgrammingsCount = 0u;
 
     uint32_t deviceIndex = 0u;
     // taskCount - # of tasks submitted
@@ -243,6 +256,8 @@ class CommandStreamReceiver {
     bool lastVmeSubslicesConfig = false;
     bool disableL3Cache = false;
     bool stallingPipeControlOnNextFlushRequired = false;
+    // wrapped heap keeps its base address, caches may still hold state written in its previous lap
+    bool heapWrapInvalidationRequired = false;
     bool timestampPacketWriteEnabled = false;
     bool nTo1SubmissionModelEnabled = false;
     bool lastSpecialPipelineSelectMode = false;
@@ -29,6 +29,9 @@
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/os_context.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/timeline_tracer.h"
+
+#include <chrono>
 
 namespace OCLRT {
 
@@ -158,6 +161,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     DEBUG_BREAK_IF(taskLevel >= Event::eventNotReady);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
+    TimelineScope timelineScope("CommandStreamReceiver::flushTask", this->taskCount + 1);
 
     auto levelClosed = false;
     void *currentPipeControlForNooping = nullptr;
@@ -337,12 +341,21 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         programStateSip(commandStreamCSR, device);
 
         latestSentStatelessMocsConfig = requiredL3Index;
+        stateBaseAddressProgrammingsCount++;
 
         if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
             collectStateBaseAddresPatchInfo(commandStream.getGraphicsAllocation()->getGpuAddress(), stateBaseAddressCmdOffset, dsh, ioh, ssh, newGSHbase);
         }
     }
 
+    if (heapWrapInvalidationRequired) {
+        auto pCmd = addPipeControlCmd(commandStreamCSR);
+        pCmd->setStateCacheInvalidationEnable(true);
+        pCmd->setTextureCacheInvalidationEnable(true);
+        pCmd->setConstantCacheInvalidationEnable(true);
+        heapWrapInvalidationRequired = false;
+    }
+
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "this->taskLevel", (uint32_t)this->taskLevel);
 
     if (device.getWaTable()->waSamplerCacheFlushBetweenRedescribedSurfaceReads) {
@@ -448,6 +461,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     if (submitCSR | submitTask) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
+            TimelineScope flushScope("CommandStreamReceiver::flush", this->taskCount + 1);
             flushStamp->setStamp(this->flush(batchBuffer, this->getResidencyAllocations()));
             this->latestFlushedTaskCount = this->taskCount + 1;
             this->makeSurfacePackNonResident(this->getResidencyAllocations());
@@ -478,6 +492,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
 
     ++taskCount;
+    recordHeapsUsage(taskCount);
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskCount", taskCount);
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "Current taskCount:", tagAddress ? *tagAddress : 0);
 
@@ -570,7 +585,11 @@ inline void CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
                 }
                 ((PIPE_CONTROL *)epiloguePipeControlLocation)->setDcFlushEnable(flushDcInEpilogue);
             }
+            TimelineScope flushScope("CommandStreamReceiver::flush", lastTaskCount);
+            auto submissionStart = std::chrono::high_resolution_clock::now();
             auto flushStamp = this->flush(primaryCmdBuffer->batchBuffer, surfacesForSubmit);
+            auto submissionLatency = std::chrono::high_resolution_clock::now() - submissionStart;
+            this->submissionAggregator->reportSubmissionLatency(std::chrono::duration_cast<std::chrono::microseconds>(submissionLatency).count());
 
             //after flush task level is closed
             this->taskLevel++;
@@ -652,6 +671,9 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     if (stallingPipeControlOnNextFlushRequired) {
         size += sizeof(typename GfxFamily::PIPE_CONTROL);
     }
+    if (heapWrapInvalidationRequired) {
+        size += sizeof(typename GfxFamily::PIPE_CONTROL);
+    }
     return size;
 }
 
@@ -665,10 +687,14 @@ inline void CommandStreamReceiverHw<GfxFamily>::emitNoop(LinearStream &commandSt
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) {
+    TimelineScope timelineScope("CommandStreamReceiver::waitForTaskCount", taskCountToWait);
     int64_t waitTimeout = 0;
+    bool completedBeforeWait = *getTagAddress() >= taskCountToWait;
     bool enableTimeout = kmdNotifyHelper->obtainTimeoutParams(waitTimeout, useQuickKmdSleep, *getTagAddress(), taskCountToWait, flushStampToWait, forcePowerSavingMode);
 
+    auto waitStart = std::chrono::steady_clock::now();
     auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait);
+    auto spinEnd = std::chrono::steady_clock::now();
     if (!status) {
         waitForFlushStamp(flushStampToWait);
         //now call blocking wait, this is to ensure that task count is reached
@@ -676,6 +702,11 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
     }
     UNRECOVERABLE_IF(*getTagAddress() < taskCountToWait);
 
+    auto waitEnd = status ? spinEnd : std::chrono::steady_clock::now();
+    kmdNotifyHelper->recordWait(std::chrono::duration_cast<std::chrono::microseconds>(waitEnd - waitStart).count(),
+                                std::chrono::duration_cast<std::chrono::microseconds>(spinEnd - waitStart).count(),
+                                !status, completedBeforeWait);
+
     if (kmdNotifyHelper->quickKmdSleepForSporadicWaitsEnabled()) {
         kmdNotifyHelper->updateLastWaitForCompletionTimestamp();
     }
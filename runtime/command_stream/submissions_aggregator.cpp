@@ -10,6 +10,10 @@
 #include "runtime/helpers/flush_stamp.h"
 #include "runtime/memory_manager/graphics_allocation.h"
 
+#include <algorithm>
+
+constexpr uint32_t OCLRT::SubmissionAggregator::maxAdaptiveCommandBuffersPerExec;
+
 void OCLRT::SubmissionAggregator::recordCommandBuffer(CommandBuffer *commandBuffer) {
     this->cmdBuffers.pushTailOne(*commandBuffer);
 }
@@ -22,6 +26,8 @@ void OCLRT::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resou
         return;
     }
     auto primaryBatchGraphicsAllocation = primaryCommandBuffer->batchBuffer.commandBufferAllocation;
+    auto initialUsedSize = totalUsedSize;
+    uint32_t mergedCommandBuffersCount = 1u;
 
     this->inspectionId++;
     primaryCommandBuffer->inspectionId = currentInspection;
@@ -35,63 +41,75 @@ void OCLRT::SubmissionAggregator::aggregateCommandBuffers(ResourcePackage &resou
         }
     }
 
-    //check if we have anything for merge
-    if (!primaryCommandBuffer->next) {
-        return;
-    }
-
-    //check if next cmd buffer is compatible
-    if (primaryCommandBuffer->next->batchBuffer.requiresCoherency != primaryCommandBuffer->batchBuffer.requiresCoherency) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.low_priority != primaryCommandBuffer->batchBuffer.low_priority) {
-        return;
-    }
-
-    if (primaryCommandBuffer->next->batchBuffer.throttle != primaryCommandBuffer->batchBuffer.throttle) {
-        return;
-    }
+    //check if we have anything for merge and if next cmd buffer is compatible
+    if (primaryCommandBuffer->next && isCompatible(*primaryCommandBuffer, *primaryCommandBuffer->next)) {
+        auto nextCommandBuffer = primaryCommandBuffer->next;
+        ResourcePackage newResources;
 
-    auto nextCommandBuffer = primaryCommandBuffer->next;
-    ResourcePackage newResources;
-
-    while (nextCommandBuffer) {
-        size_t nextCommandBufferNewResourcesSize = 0;
-        //evaluate if buffer fits
-        for (auto &graphicsAllocation : nextCommandBuffer->surfaces) {
-            if (graphicsAllocation == primaryBatchGraphicsAllocation) {
-                continue;
+        while (nextCommandBuffer) {
+            if (maxCommandBuffersPerExec != 0u && mergedCommandBuffersCount >= maxCommandBuffersPerExec) {
+                break;
             }
-            if (graphicsAllocation->getInspectionId(osContextId) < currentInspection) {
-                graphicsAllocation->setInspectionId(currentInspection, osContextId);
-                newResources.push_back(graphicsAllocation);
-                nextCommandBufferNewResourcesSize += graphicsAllocation->getUnderlyingBufferSize();
+            size_t nextCommandBufferNewResourcesSize = 0;
+            //evaluate if buffer fits
+            for (auto &graphicsAllocation : nextCommandBuffer->surfaces) {
+                if (graphicsAllocation == primaryBatchGraphicsAllocation) {
+                    continue;
+                }
+                if (graphicsAllocation->getInspectionId(osContextId) < currentInspection) {
+                    graphicsAllocation->setInspectionId(currentInspection, osContextId);
+                    newResources.push_back(graphicsAllocation);
+                    nextCommandBufferNewResourcesSize += graphicsAllocation->getUnderlyingBufferSize();
+                }
             }
-        }
 
-        if (nextCommandBuffer->batchBuffer.commandBufferAllocation && (nextCommandBuffer->batchBuffer.commandBufferAllocation != primaryBatchGraphicsAllocation)) {
-            if (nextCommandBuffer->batchBuffer.commandBufferAllocation->getInspectionId(osContextId) < currentInspection) {
-                nextCommandBuffer->batchBuffer.commandBufferAllocation->setInspectionId(currentInspection, osContextId);
-                newResources.push_back(nextCommandBuffer->batchBuffer.commandBufferAllocation);
-                nextCommandBufferNewResourcesSize += nextCommandBuffer->batchBuffer.commandBufferAllocation->getUnderlyingBufferSize();
+            if (nextCommandBuffer->batchBuffer.commandBufferAllocation && (nextCommandBuffer->batchBuffer.commandBufferAllocation != primaryBatchGraphicsAllocation)) {
+                if (nextCommandBuffer->batchBuffer.commandBufferAllocation->getInspectionId(osContextId) < currentInspection) {
+                    nextCommandBuffer->batchBuffer.commandBufferAllocation->setInspectionId(currentInspection, osContextId);
+                    newResources.push_back(nextCommandBuffer->batchBuffer.commandBufferAllocation);
+                    nextCommandBufferNewResourcesSize += nextCommandBuffer->batchBuffer.commandBufferAllocation->getUnderlyingBufferSize();
+                }
             }
-        }
 
-        if (nextCommandBufferNewResourcesSize + totalUsedSize <= totalMemoryBudget) {
-            auto currentNode = nextCommandBuffer;
-            nextCommandBuffer = nextCommandBuffer->next;
-            totalUsedSize += nextCommandBufferNewResourcesSize;
-            currentNode->inspectionId = currentInspection;
-
-            for (auto &newResource : newResources) {
-                resourcePackage.push_back(newResource);
+            if (nextCommandBufferNewResourcesSize + totalUsedSize <= totalMemoryBudget) {
+                auto currentNode = nextCommandBuffer;
+                nextCommandBuffer = nextCommandBuffer->next;
+                totalUsedSize += nextCommandBufferNewResourcesSize;
+                currentNode->inspectionId = currentInspection;
+                mergedCommandBuffersCount++;
+
+                for (auto &newResource : newResources) {
+                    resourcePackage.push_back(newResource);
+                }
+                newResources.clear();
+            } else {
+                break;
             }
-            newResources.clear();
-        } else {
-            break;
         }
     }
+
+    lastMergedCommandBuffersCount = mergedCommandBuffersCount;
+    statistics.execsCount++;
+    statistics.mergedCommandBuffersCount += mergedCommandBuffersCount;
+    statistics.residentBytes += totalUsedSize - initialUsedSize;
+}
+
+void OCLRT::SubmissionAggregator::reportSubmissionLatency(int64_t latencyMicroseconds) {
+    if (targetSubmissionLatency <= 0) {
+        return;
+    }
+    if (latencyMicroseconds > targetSubmissionLatency) {
+        maxCommandBuffersPerExec = std::max(lastMergedCommandBuffersCount / 2, 1u);
+    } else if (latencyMicroseconds * 2 < targetSubmissionLatency &&
+               maxCommandBuffersPerExec != 0u && lastMergedCommandBuffersCount >= maxCommandBuffersPerExec) {
+        maxCommandBuffersPerExec = std::min(maxCommandBuffersPerExec * 2, maxAdaptiveCommandBuffersPerExec);
+    }
+}
+
+bool OCLRT::SubmissionAggregator::isCompatible(const CommandBuffer &primaryCommandBuffer, const CommandBuffer &commandBuffer) const {
+    return commandBuffer.batchBuffer.requiresCoherency == primaryCommandBuffer.batchBuffer.requiresCoherency &&
+           commandBuffer.batchBuffer.low_priority == primaryCommandBuffer.batchBuffer.low_priority &&
+           commandBuffer.batchBuffer.throttle == primaryCommandBuffer.batchBuffer.throttle;
 }
 
 OCLRT::BatchBuffer::BatchBuffer(GraphicsAllocation *commandBufferAllocation, size_t startOffset, size_t chainedBatchBufferStartOffset, GraphicsAllocation *chainedBatchBuffer, bool requiresCoherency, bool lowPriority, QueueThrottle throttle, size_t usedSize, LinearStream *stream) : commandBufferAllocation(commandBufferAllocation), startOffset(startOffset), chainedBatchBufferStartOffset(chainedBatchBufferStartOffset), chainedBatchBuffer(chainedBatchBuffer), requiresCoherency(requiresCoherency), low_priority(lowPriority), throttle(throttle), usedSize(usedSize), stream(stream) {
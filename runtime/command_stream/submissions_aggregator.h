@@ -60,14 +60,36 @@ struct CommandBufferList : public IDList<CommandBuffer, false, true, false> {};
 
 using ResourcePackage = StackVec<GraphicsAllocation *, 128>;
 
+struct SubmissionStatistics {
+    uint64_t execsCount = 0u;
+    uint64_t mergedCommandBuffersCount = 0u;
+    uint64_t residentBytes = 0u;
+};
+
 class SubmissionAggregator {
   public:
+    static constexpr uint32_t maxAdaptiveCommandBuffersPerExec = 256u;
+
     void recordCommandBuffer(CommandBuffer *commandBuffer);
     void aggregateCommandBuffers(ResourcePackage &resourcePackage, size_t &totalUsedSize, size_t totalMemoryBudget, uint32_t osContextId);
     CommandBufferList &peekCmdBufferList() { return cmdBuffers; }
 
+    void setMaxCommandBuffersPerExec(uint32_t maxCommandBuffers) { maxCommandBuffersPerExec = maxCommandBuffers; }
+    uint32_t getMaxCommandBuffersPerExec() const { return maxCommandBuffersPerExec; }
+    void setTargetSubmissionLatency(int64_t latencyMicroseconds) { targetSubmissionLatency = latencyMicroseconds; }
+    void reportSubmissionLatency(int64_t latencyMicroseconds);
+    const SubmissionStatistics &getStatistics() const { return statistics; }
+
   protected:
+    bool isCompatible(const CommandBuffer &primaryCommandBuffer, const CommandBuffer &commandBuffer) const;
+
     CommandBufferList cmdBuffers;
     uint32_t inspectionId = 1;
+    // 0 - no limit
+    uint32_t maxCommandBuffersPerExec = 0u;
+    uint32_t lastMergedCommandBuffersCount = 0u;
+    // 0 - batch size does not adapt to submission latency
+    int64_t targetSubmissionLatency = 0;
+    SubmissionStatistics statistics;
 };
 } // namespace OCLRT
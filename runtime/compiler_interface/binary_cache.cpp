@@ -8,26 +8,63 @@
 #include <runtime/compiler_interface/binary_cache.h>
 #include <runtime/helpers/aligned_memory.h>
 #include <runtime/helpers/file_io.h>
-#include <runtime/helpers/hash.h>
 #include <runtime/helpers/hw_info.h>
+#include <runtime/helpers/striped_hash.h>
+#include <runtime/helpers/stdio.h>
+#include <runtime/memory_manager/memory_constants.h>
+#include <runtime/os_interface/os_file.h>
+#include <runtime/os_interface/os_file_lock.h>
 #include <runtime/os_interface/os_inc_base.h>
+#include <runtime/os_interface/os_mapped_file.h>
 #include <runtime/program/program.h>
 #include <runtime/utilities/debug_settings_reader.h>
+#include <runtime/utilities/directory.h>
 
 #include "config.h"
+#include "driver_version.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <mutex>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 
 namespace OCLRT {
-std::mutex BinaryCache::cacheAccessMtx;
+#define QTR(a) #a
+#define TOSTR(b) QTR(b)
+
+const std::string BinaryCache::indexFileName = "cl_cache.index";
+constexpr uint32_t BinaryCache::indexSaveInterval;
+
+namespace {
+const std::string cachedFileExtension = ".cl_cache";
+
+// Serializes index updates of all processes sharing the cache directory.
+// OS releases the lock of a terminated owner, so a lock held longer than the timeout belongs to a live process.
+std::unique_ptr<FileLock> lockIndexFile(const std::string &indexFilePath, uint32_t attempts) {
+    auto lockFilePath = indexFilePath + ".lock";
+    for (uint32_t attempt = 0; attempt < attempts; attempt++) {
+        auto lock = FileLock::tryLock(lockFilePath);
+        if (lock != nullptr) {
+            return lock;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return nullptr;
+}
+} // namespace
+
 const std::string BinaryCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                  const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+    StripedHash hash;
 
     hash.update("----", 4);
     hash.update(&*input.begin(), input.size());
@@ -56,44 +93,283 @@ BinaryCache::BinaryCache() {
     std::string keyName = "cl_cache_dir";
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(keyName));
     clCacheLocation = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
+
+    std::string sizeLimitKeyName = "cl_cache_size_limit_mb";
+    std::unique_ptr<SettingsReader> sizeLimitReader(SettingsReader::createOsReader(sizeLimitKeyName));
+    auto sizeLimitInMB = sizeLimitReader->getSetting(sizeLimitReader->appSpecificLocation(sizeLimitKeyName), 0);
+    if (sizeLimitInMB > 0) {
+        maxCacheSize = static_cast<uint64_t>(sizeLimitInMB) * MemoryConstants::megaByte;
+    }
+
+    driverVersion = TOSTR(NEO_DRIVER_VERSION);
+    if (isSizeLimitEnabled()) {
+        loadIndex();
+    }
 };
 
-BinaryCache::~BinaryCache(){};
+BinaryCache::~BinaryCache() {
+    if (isSizeLimitEnabled()) {
+        saveIndex();
+    }
+};
 
-bool BinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
-    if (pBinary == nullptr || binarySize == 0) {
+BinaryCacheStatistics BinaryCache::getStatistics() const {
+    BinaryCacheStatistics statistics;
+    statistics.hits = hits.load();
+    statistics.misses = misses.load();
+    statistics.evictions = evictions.load();
+    return statistics;
+}
+
+std::string BinaryCache::getFilePath(const std::string &kernelFileHash) const {
+    return clCacheLocation + PATH_SEPARATOR + kernelFileHash + cachedFileExtension;
+}
+
+bool BinaryCache::writeFileAtomically(const std::string &filePath, const void *pData, size_t dataSize) const {
+    static std::atomic<uint64_t> tempFileCounter{0u};
+    static const auto processSeed = static_cast<uint64_t>(std::random_device{}());
+
+    std::stringstream tempFilePath;
+    tempFilePath << filePath << "." << std::hex << processSeed
+                 << "." << std::hash<std::thread::id>()(std::this_thread::get_id())
+                 << "." << tempFileCounter++ << ".tmp";
+    auto tempFileName = tempFilePath.str();
+
+    if (writeDataToFile(tempFileName.c_str(), pData, dataSize) == 0) {
+        std::remove(tempFileName.c_str());
         return false;
     }
-    std::string filePath = clCacheLocation + PATH_SEPARATOR + kernelFileHash + ".cl_cache";
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    if (writeDataToFile(
-            filePath.c_str(),
-            pBinary,
-            binarySize) == 0) {
+
+    // readers see either the previous or the complete new file, never a partially written one
+    if (!replaceFile(tempFileName, filePath)) {
+        std::remove(tempFileName.c_str());
         return false;
     }
-
     return true;
 }
 
-bool BinaryCache::loadCachedBinary(const std::string kernelFileHash, Program &program) {
-    void *pBinary = nullptr;
-    size_t binarySize = 0;
+void BinaryCache::removeCachedFiles(const std::vector<std::string> &kernelFileHashes) const {
+    for (auto &kernelFileHash : kernelFileHashes) {
+        std::remove(getFilePath(kernelFileHash).c_str());
+    }
+}
+
+std::vector<std::pair<std::string, BinaryCache::IndexEntry>> BinaryCache::readIndexFile() const {
+    std::vector<std::pair<std::string, IndexEntry>> entries;
+    std::ifstream indexFile(clCacheLocation + PATH_SEPARATOR + indexFileName);
+    std::string line;
+    while (std::getline(indexFile, line)) {
+        std::istringstream lineStream(line);
+        std::string kernelFileHash;
+        IndexEntry entry;
+        if (!(lineStream >> kernelFileHash >> entry.size >> entry.lastAccess)) {
+            continue;
+        }
+        lineStream >> entry.driverVersion;
+        entries.emplace_back(kernelFileHash, entry);
+    }
+    return entries;
+}
+
+void BinaryCache::addUntrackedFiles(std::vector<std::pair<std::string, IndexEntry>> &entries) const {
+    std::unordered_set<std::string> trackedEntries;
+    for (auto &entry : entries) {
+        trackedEntries.insert(entry.first);
+    }
+
+    // binaries cached without size limit or by a lost index update still occupy the budget
+    auto cacheLocation = clCacheLocation;
+    for (auto &file : Directory::getFiles(cacheLocation)) {
+        if (file.size() <= cachedFileExtension.size() ||
+            file.compare(file.size() - cachedFileExtension.size(), cachedFileExtension.size(), cachedFileExtension) != 0) {
+            continue;
+        }
+        auto nameBegin = file.find_last_of("/\\") + 1;
+        auto kernelFileHash = file.substr(nameBegin, file.size() - cachedFileExtension.size() - nameBegin);
+        if (trackedEntries.count(kernelFileHash) != 0) {
+            continue;
+        }
+
+        std::ifstream cachedFile(file, std::ios::binary | std::ios::ate);
+        if (!cachedFile.good()) {
+            continue;
+        }
+        IndexEntry entry;
+        entry.size = static_cast<uint64_t>(cachedFile.tellg());
+        entry.lastAccess = 0u;
+        entry.driverVersion = driverVersion;
+        entries.emplace_back(kernelFileHash, entry);
+    }
+}
+
+void BinaryCache::loadIndex() {
+    auto storedEntries = readIndexFile();
+    addUntrackedFiles(storedEntries);
+
+    std::multimap<uint64_t, std::pair<std::string, uint64_t>> accessOrder;
+    std::vector<std::string> filesToRemove;
+    for (auto &storedEntry : storedEntries) {
+        if (storedEntry.second.driverVersion != driverVersion) {
+            // binaries produced by a different driver are never hit again, reclaim their space
+            filesToRemove.push_back(storedEntry.first);
+            evictions++;
+            continue;
+        }
+        accessOrder.emplace(storedEntry.second.lastAccess, std::make_pair(storedEntry.first, storedEntry.second.size));
+    }
 
-    std::string filePath = clCacheLocation + PATH_SEPARATOR + kernelFileHash + ".cl_cache";
+    {
+        std::lock_guard<std::mutex> lock(indexMtx);
+        // replay in access order, so stamps written by concurrent processes collapse into one sequence,
+        // untracked files have no stamp and become least recently used
+        for (auto &entry : accessOrder) {
+            touchEntry(entry.second.first, entry.second.second);
+        }
+        auto evicted = evictToFit(0u);
+        filesToRemove.insert(filesToRemove.end(), evicted.begin(), evicted.end());
+    }
+    removeCachedFiles(filesToRemove);
+}
+
+void BinaryCache::saveIndex() {
+    auto indexFilePath = clCacheLocation + PATH_SEPARATOR + indexFileName;
+    auto indexFileLock = lockIndexFile(indexFilePath, indexLockAttempts);
+    if (indexFileLock == nullptr) {
+        // writing without the lock could drop updates of the owner, index is saved again by a later write or on destruction
+        return;
+    }
 
+    // merge entries saved by other processes since this index was loaded, so their updates are not lost
+    auto savedEntries = readIndexFile();
+    std::sort(savedEntries.begin(), savedEntries.end(), [](const std::pair<std::string, IndexEntry> &lhs, const std::pair<std::string, IndexEntry> &rhs) {
+        return lhs.second.lastAccess < rhs.second.lastAccess;
+    });
+
+    std::vector<std::string> evicted;
+    std::string serializedIndex;
     {
-        std::lock_guard<std::mutex> lock(cacheAccessMtx);
-        binarySize = loadDataFromFile(filePath.c_str(), pBinary);
+        std::lock_guard<std::mutex> lock(indexMtx);
+        for (auto &savedEntry : savedEntries) {
+            if (savedEntry.second.driverVersion == driverVersion &&
+                index.count(savedEntry.first) == 0 &&
+                removedEntries.count(savedEntry.first) == 0) {
+                touchEntry(savedEntry.first, savedEntry.second.size);
+            }
+        }
+        evicted = evictToFit(0u);
+        serializedIndex = serializeIndex();
+        removedEntries.clear();
+        unsavedIndexUpdates = 0u;
     }
+    writeFileAtomically(indexFilePath, serializedIndex.c_str(), serializedIndex.size());
+    removeCachedFiles(evicted);
+}
 
-    if ((pBinary == nullptr) || (binarySize == 0)) {
-        deleteDataReadFromFile(pBinary);
+std::string BinaryCache::serializeIndex() const {
+    std::stringstream stream;
+    for (auto &lruEntry : lruOrder) {
+        auto &entry = index.at(lruEntry.second);
+        stream << lruEntry.second << " " << entry.size << " " << entry.lastAccess << " " << entry.driverVersion << "\n";
+    }
+    return stream.str();
+}
+
+void BinaryCache::touchEntry(const std::string &kernelFileHash, uint64_t size) {
+    auto &entry = index[kernelFileHash];
+    if (entry.lastAccess != 0u) {
+        lruOrder.erase(entry.lastAccess);
+    }
+    currentCacheSize -= entry.size;
+    currentCacheSize += size;
+    entry.size = size;
+    entry.lastAccess = ++accessCounter;
+    entry.driverVersion = driverVersion;
+    lruOrder[entry.lastAccess] = kernelFileHash;
+    removedEntries.erase(kernelFileHash);
+}
+
+void BinaryCache::removeEntry(const std::string &kernelFileHash) {
+    auto it = index.find(kernelFileHash);
+    if (it == index.end()) {
+        return;
+    }
+    lruOrder.erase(it->second.lastAccess);
+    currentCacheSize -= it->second.size;
+    index.erase(it);
+    removedEntries.insert(kernelFileHash);
+}
+
+std::vector<std::string> BinaryCache::evictToFit(uint64_t requiredSize) {
+    std::vector<std::string> evicted;
+    while (!lruOrder.empty() && currentCacheSize + requiredSize > maxCacheSize) {
+        auto kernelFileHash = lruOrder.begin()->second;
+        removeEntry(kernelFileHash);
+        evicted.push_back(std::move(kernelFileHash));
+        evictions++;
+    }
+    return evicted;
+}
+
+bool BinaryCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
+    if (pBinary == nullptr || binarySize == 0) {
+        return false;
+    }
+    std::vector<std::string> evicted;
+    if (isSizeLimitEnabled()) {
+        if (binarySize > maxCacheSize) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(indexMtx);
+            removeEntry(kernelFileHash);
+            evicted = evictToFit(binarySize);
+        }
+        removeCachedFiles(evicted);
+    }
+
+    if (!writeFileAtomically(getFilePath(kernelFileHash), pBinary, binarySize)) {
+        return false;
+    }
+
+    if (isSizeLimitEnabled()) {
+        bool saveRequired = !evicted.empty();
+        {
+            std::lock_guard<std::mutex> lock(indexMtx);
+            touchEntry(kernelFileHash, binarySize);
+            saveRequired |= ++unsavedIndexUpdates >= indexSaveInterval;
+        }
+        // index is persisted in batches, and right away after eviction so other processes drop removed files
+        if (saveRequired) {
+            saveIndex();
+        }
+    }
+    return true;
+}
+
+bool BinaryCache::loadCachedBinary(const std::string kernelFileHash, Program &program) {
+    // mapping avoids an intermediate heap copy, binary is copied only once into the program
+    auto cachedFile = MappedFile::open(getFilePath(kernelFileHash));
+
+    if (cachedFile == nullptr) {
+        misses++;
+        if (isSizeLimitEnabled()) {
+            std::lock_guard<std::mutex> lock(indexMtx);
+            removeEntry(kernelFileHash);
+        }
         return false;
     }
-    program.storeGenBinary(pBinary, binarySize);
 
-    deleteDataReadFromFile(pBinary);
+    hits++;
+    if (isSizeLimitEnabled()) {
+        std::vector<std::string> evicted;
+        {
+            std::lock_guard<std::mutex> lock(indexMtx);
+            touchEntry(kernelFileHash, cachedFile->getSize());
+            evicted = evictToFit(0u);
+        }
+        removeCachedFiles(evicted);
+    }
+    program.storeGenBinary(cachedFile->getData(), cachedFile->getSize());
 
     return true;
 }
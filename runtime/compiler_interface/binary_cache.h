@@ -9,26 +9,82 @@
 
 #include "runtime/utilities/arrayref.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace OCLRT {
 struct HardwareInfo;
 class Program;
 
+struct BinaryCacheStatistics {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t evictions = 0u;
+};
+
 class BinaryCache {
   public:
+    struct IndexEntry {
+        uint64_t size = 0u;
+        uint64_t lastAccess = 0u;
+        std::string driverVersion;
+    };
+
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+    static const std::string indexFileName;
+
     BinaryCache();
     virtual ~BinaryCache();
     virtual bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     virtual bool loadCachedBinary(const std::string kernelFileHash, Program &program);
 
+    bool isSizeLimitEnabled() const { return maxCacheSize != 0u; }
+    uint64_t getMaxCacheSize() const { return maxCacheSize; }
+    uint64_t getCurrentCacheSize() const { return currentCacheSize; }
+    BinaryCacheStatistics getStatistics() const;
+
   protected:
-    static std::mutex cacheAccessMtx;
+    std::string getFilePath(const std::string &kernelFileHash) const;
+    bool writeFileAtomically(const std::string &filePath, const void *pData, size_t dataSize) const;
+    void removeCachedFiles(const std::vector<std::string> &kernelFileHashes) const;
+    void loadIndex();
+    void saveIndex();
+    std::vector<std::pair<std::string, IndexEntry>> readIndexFile() const;
+    void addUntrackedFiles(std::vector<std::pair<std::string, IndexEntry>> &entries) const;
+
+    // callers must hold indexMtx
+    std::string serializeIndex() const;
+    void touchEntry(const std::string &kernelFileHash, uint64_t size);
+    void removeEntry(const std::string &kernelFileHash);
+    std::vector<std::string> evictToFit(uint64_t requiredSize);
+
     std::string clCacheLocation;
+    std::string driverVersion;
+
+    static constexpr uint32_t indexSaveInterval = 16u;
+    uint32_t indexLockAttempts = 1000u;
+
+    uint64_t maxCacheSize = 0u;
+    uint64_t currentCacheSize = 0u;
+    uint64_t accessCounter = 0u;
+    std::mutex indexMtx;
+    std::unordered_map<std::string, IndexEntry> index;
+    std::map<uint64_t, std::string> lruOrder;
+    // entries dropped by this cache, not restored when merging with the index saved by other processes
+    std::unordered_set<std::string> removedEntries;
+    uint32_t unsavedIndexUpdates = 0u;
+
+    std::atomic<uint64_t> hits{0u};
+    std::atomic<uint64_t> misses{0u};
+    std::atomic<uint64_t> evictions{0u};
 };
 } // namespace OCLRT
@@ -23,6 +23,7 @@
 #include "runtime/os_interface/os_context.h"
 #include "runtime/os_interface/os_interface.h"
 #include "runtime/os_interface/os_time.h"
+#include "runtime/program/printf_surface_pool.h"
 #include "runtime/source_level_debugger/source_level_debugger.h"
 
 #include "hw_cmds.h"
@@ -77,6 +78,7 @@ Device::Device(const HardwareInfo &hwInfo, ExecutionEnvironment *executionEnviro
         this->executionEnvironment->initSourceLevelDebugger();
     }
     this->executionEnvironment->incRefInternal();
+    printfSurfacePool = std::make_unique<PrintfSurfacePool>(*executionEnvironment);
     auto &hwHelper = HwHelper::get(hwInfo.pPlatform->eRenderCoreFamily);
     hwHelper.setupHardwareCapabilities(&this->hardwareCapabilities, hwInfo);
 }
@@ -99,6 +101,7 @@ Device::~Device() {
         executionEnvironment->memoryManager->freeGraphicsMemory(preemptionAllocation);
         preemptionAllocation = nullptr;
     }
+    printfSurfacePool.reset();
     executionEnvironment->memoryManager->waitForDeletions();
 
     alignedFree(this->slmWindowStartAddress);
@@ -215,6 +218,7 @@ void *Device::getSLMWindowStartAddress() {
 }
 
 void Device::prepareSLMWindow() {
+    std::lock_guard<std::mutex> lock(slmWindowMutex);
     if (this->slmWindowStartAddress == nullptr) {
         this->slmWindowStartAddress = executionEnvironment->memoryManager->allocateSystemMemory(MemoryConstants::slmWindowSize, MemoryConstants::slmWindowAlignment);
     }
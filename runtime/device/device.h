@@ -17,6 +17,7 @@
 
 #include "engine_node.h"
 
+#include <mutex>
 #include <vector>
 
 namespace OCLRT {
@@ -25,6 +26,7 @@ class GraphicsAllocation;
 class MemoryManager;
 class OSTime;
 class DriverInfo;
+class PrintfSurfacePool;
 struct HardwareInfo;
 class SourceLevelDebugger;
 class OsContext;
@@ -104,6 +106,7 @@ class Device : public BaseObject<_cl_device_id> {
     void checkPriorityHints();
     GFXCORE_FAMILY getRenderCoreFamily() const;
     PerformanceCounters *getPerformanceCounters() { return performanceCounters.get(); }
+    PrintfSurfacePool *getPrintfSurfacePool() { return printfSurfacePool.get(); }
     static decltype(&PerformanceCounters::create) createPerformanceCountersFunc;
     PreemptionMode getPreemptionMode() const { return preemptionMode; }
     GraphicsAllocation *getPreemptionAllocation() const { return preemptionAllocation; }
@@ -152,10 +155,12 @@ class Device : public BaseObject<_cl_device_id> {
     std::unique_ptr<OSTime> osTime;
     std::unique_ptr<DriverInfo> driverInfo;
     std::unique_ptr<PerformanceCounters> performanceCounters;
+    std::unique_ptr<PrintfSurfacePool> printfSurfacePool;
 
     std::vector<EngineControl> engines;
 
     void *slmWindowStartAddress = nullptr;
+    std::mutex slmWindowMutex;
 
     std::string exposedBuiltinKernels = "";
 
@@ -7,10 +7,13 @@
 
 #include "runtime/event/async_events_handler.h"
 
+#include "runtime/command_queue/command_queue.h"
+#include "runtime/command_stream/command_stream_receiver.h"
 #include "runtime/event/event.h"
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace OCLRT {
@@ -40,13 +43,21 @@ Event *AsyncEventsHandler::processList() {
     Event *sleepCandidate = nullptr;
     pendingList.clear();
 
+    transferCompletedSubmittedEvents();
+
     for (auto event : list) {
         event->updateExecutionStatus();
         if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
-            pendingList.push_back(event);
-            if (event->peekTaskCount() < lowestTaskCount) {
-                sleepCandidate = event;
-                lowestTaskCount = event->peekTaskCount();
+            auto commandQueue = event->getCommandQueue();
+            if (commandQueue && !event->isExternallySynchronized() &&
+                event->peekExecutionStatus() == CL_SUBMITTED && event->peekTaskCount() != Event::eventNotReady) {
+                addSubmittedEvent(commandQueue->getCommandStreamReceiver(), *event);
+            } else {
+                pendingList.push_back(event);
+                if (event->peekTaskCount() < lowestTaskCount) {
+                    sleepCandidate = event;
+                    lowestTaskCount = event->peekTaskCount();
+                }
             }
         } else {
             event->decRefInternal();
@@ -54,9 +65,39 @@ Event *AsyncEventsHandler::processList() {
     }
 
     list.swap(pendingList);
+
+    for (auto &csrEvents : submittedEvents) {
+        auto &heap = csrEvents.second;
+        if (heap.front().taskCount < lowestTaskCount) {
+            sleepCandidate = heap.front().event;
+            lowestTaskCount = heap.front().taskCount;
+        }
+    }
     return sleepCandidate;
 }
 
+void AsyncEventsHandler::addSubmittedEvent(CommandStreamReceiver &csr, Event &event) {
+    submittedEvents[&csr].push(event, event.peekTaskCount());
+    submittedEventsCount++;
+}
+
+void AsyncEventsHandler::transferCompletedSubmittedEvents() {
+    for (auto csrEvents = submittedEvents.begin(); csrEvents != submittedEvents.end();) {
+        auto &heap = csrEvents->second;
+        uint32_t tag = *csrEvents->first->getTagAddress();
+        while (!heap.empty() && heap.front().taskCount <= tag) {
+            list.push_back(heap.pop().event);
+            submittedEventsCount--;
+        }
+        // CSR without submitted events is not kept, it may be destroyed before next processing
+        if (heap.empty()) {
+            csrEvents = submittedEvents.erase(csrEvents);
+        } else {
+            ++csrEvents;
+        }
+    }
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -70,7 +111,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (!self->hasEventsToProcess()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -113,6 +154,13 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &csrEvents : submittedEvents) {
+        for (auto &submittedEvent : csrEvents.second) {
+            submittedEvent.event->decRefInternal();
+        }
+    }
+    submittedEvents.clear();
+    submittedEventsCount = 0u;
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
 } // namespace OCLRT
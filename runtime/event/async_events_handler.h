@@ -6,13 +6,17 @@
  */
 
 #pragma once
+#include "runtime/event/task_count_event_heap.h"
+
 #include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace OCLRT {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -27,11 +31,18 @@ class AsyncEventsHandler {
     Event *processList();
     static void *asyncProcess(void *arg);
     void releaseEvents();
+    bool hasEventsToProcess() const { return !list.empty() || submittedEventsCount != 0; }
+    void addSubmittedEvent(CommandStreamReceiver &csr, Event &event);
+    void transferCompletedSubmittedEvents();
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    // submitted events can change state only when their task count is reached,
+    // they are kept per CSR and not polled until then
+    std::unordered_map<CommandStreamReceiver *, TaskCountEventHeap> submittedEvents;
+    size_t submittedEventsCount = 0u;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/completion_dispatcher.h"
+
+#include "runtime/event/event.h"
+#include "runtime/utilities/stackvec.h"
+
+namespace OCLRT {
+
+void CompletionDispatcher::registerEvent(Event &event, uint32_t taskCount) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (event.registeredForCompletion) {
+        return;
+    }
+    event.registeredForCompletion = true;
+    event.registeredCompletionStamp = taskCount;
+    registeredEvents.push(event, taskCount);
+    updateLowestTaskCount();
+}
+
+void CompletionDispatcher::unregisterEvent(Event &event) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!event.registeredForCompletion) {
+        return;
+    }
+    event.registeredForCompletion = false;
+    TaskCountEventHeap::Entry entry = {event.registeredCompletionStamp, &event};
+    if (!consumeEntry(poppedDestroyedEvents, entry)) {
+        unregisteredEvents.insert({&event, event.registeredCompletionStamp});
+    }
+    updateLowestTaskCount();
+}
+
+void CompletionDispatcher::dispatch(uint32_t completedTaskCount) {
+    if (completedTaskCount < lowestTaskCount) {
+        return;
+    }
+
+    StackVec<Event *, 32> completedEvents;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        while (!registeredEvents.empty() && registeredEvents.front().taskCount <= completedTaskCount) {
+            auto entry = registeredEvents.pop();
+            if (consumeEntry(unregisteredEvents, entry)) {
+                continue;
+            }
+            // event being destroyed keeps its flag, its destructor waits on the lock in unregisterEvent
+            if (!entry.event->tryIncRefInternal()) {
+                poppedDestroyedEvents.insert({entry.event, entry.taskCount});
+                continue;
+            }
+            entry.event->registeredForCompletion = false;
+            completedEvents.push_back(entry.event);
+        }
+        updateLowestTaskCount();
+    }
+
+    for (auto event : completedEvents) {
+        event->updateExecutionStatus();
+        event->decRefInternal();
+    }
+}
+
+size_t CompletionDispatcher::getRegisteredEventsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return registeredEvents.size() - unregisteredEvents.size();
+}
+
+bool CompletionDispatcher::consumeEntry(std::unordered_multimap<Event *, uint32_t> &events, const TaskCountEventHeap::Entry &entry) {
+    auto range = events.equal_range(entry.event);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == entry.taskCount) {
+            events.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CompletionDispatcher::updateLowestTaskCount() {
+    // drop unregistered entries from the front, so dispatch is not entered for them
+    while (!registeredEvents.empty() && consumeEntry(unregisteredEvents, registeredEvents.front())) {
+        registeredEvents.pop();
+    }
+    lowestTaskCount = registeredEvents.empty() ? UINT32_MAX : registeredEvents.front().taskCount;
+}
+} // namespace OCLRT
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/event/task_count_event_heap.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace OCLRT {
+class Event;
+
+// Completes events of a single command stream receiver in task count order.
+// Whenever a tag update is observed, all registered events up to that tag are
+// completed in one sweep, so waiters do not have to poll every event separately.
+// Events are not referenced while registered, they unregister on destruction.
+// Unregistered events are left in the heap and skipped when they reach the front.
+class CompletionDispatcher {
+  public:
+    CompletionDispatcher() = default;
+    CompletionDispatcher(const CompletionDispatcher &) = delete;
+    CompletionDispatcher &operator=(const CompletionDispatcher &) = delete;
+
+    void registerEvent(Event &event, uint32_t taskCount);
+    void unregisterEvent(Event &event);
+    void dispatch(uint32_t completedTaskCount);
+
+    size_t getRegisteredEventsCount();
+    uint32_t peekLowestTaskCount() const { return lowestTaskCount; }
+
+  protected:
+    static bool consumeEntry(std::unordered_multimap<Event *, uint32_t> &events, const TaskCountEventHeap::Entry &entry);
+    void updateLowestTaskCount();
+
+    std::mutex mtx;
+    TaskCountEventHeap registeredEvents;
+    // entries of destroyed events still in the heap, the event must not be dereferenced
+    std::unordered_multimap<Event *, uint32_t> unregisteredEvents;
+    // events popped while being destroyed, already out of the heap when their destructor unregisters them
+    std::unordered_multimap<Event *, uint32_t> poppedDestroyedEvents;
+    // lets dispatch return without locking while nothing can complete
+    std::atomic<uint32_t> lowestTaskCount{UINT32_MAX};
+};
+} // namespace OCLRT
@@ -14,6 +14,7 @@
 #include "runtime/context/context.h"
 #include "runtime/device/device.h"
 #include "runtime/event/async_events_handler.h"
+#include "runtime/event/completion_dispatcher.h"
 #include "runtime/event/event_tracker.h"
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/get_info.h"
@@ -21,10 +22,12 @@
 #include "runtime/helpers/timestamp_packet.h"
 #include "runtime/mem_obj/mem_obj.h"
 #include "runtime/memory_manager/internal_allocation_storage.h"
+#include "runtime/os_interface/os_time.h"
 #include "runtime/platform/platform.h"
 #include "runtime/utilities/range.h"
 #include "runtime/utilities/stackvec.h"
 #include "runtime/utilities/tag_allocator.h"
+#include "runtime/utilities/timeline_tracer.h"
 
 namespace OCLRT {
 
@@ -100,6 +103,9 @@ Event::~Event() {
     }
 
     DBG_LOG(EventsDebugEnable, "~Event()", this);
+    if (registeredForCompletion) {
+        cmdQueue->getCommandStreamReceiver().getCompletionDispatcher().unregisterEvent(*this);
+    }
     //no commands should be registred
     DEBUG_BREAK_IF(this->cmdToSubmit.load());
 
@@ -292,13 +298,13 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     uint64_t cpuCompleteDuration = 0;
 
     double frequency = cmdQueue->getDevice().getDeviceInfo().profilingTimerResolution;
-    int64_t c0 = queueTimeStamp.CPUTimeinNS - static_cast<uint64_t>(queueTimeStamp.GPUTimeStamp * frequency);
     /* calculation based on equation
-       CpuTime = GpuTime * scalar + const( == c0)
-       scalar = DeltaCpu( == dCpu) / DeltaGpu( == dGpu)
-       to determine the value of the const we can use one pair of values
-       const = CpuTimeQueue - GpuTimeQueue * scalar
+       CpuTime = CpuTimeRef + (GpuTime - GpuTimeRef) * scalar
+       scalar and the reference pair are fitted by the device CPU/GPU time calibration to follow clock drift,
+       until it has samples the queue timestamp of this event is the reference and scalar equals the timer resolution
     */
+    CpuGpuTimeModel timeModel = {frequency, queueTimeStamp.GPUTimeStamp, queueTimeStamp.CPUTimeinNS};
+    cmdQueue->getDevice().getOSTime()->getCpuGpuTimeCalibration().getModel(frequency, timeModel);
 
     //If device enqueue has not updated complete timestamp, assign end timestamp
     gpuDuration = getDelta(contextStartTS, contextEndTS);
@@ -308,10 +314,10 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     } else {
         gpuCompleteDuration = getDelta(contextStartTS, *contextCompleteTS);
     }
-    cpuDuration = static_cast<uint64_t>(gpuDuration * frequency);
-    cpuCompleteDuration = static_cast<uint64_t>(gpuCompleteDuration * frequency);
+    cpuDuration = static_cast<uint64_t>(gpuDuration * timeModel.nsPerTick);
+    cpuCompleteDuration = static_cast<uint64_t>(gpuCompleteDuration * timeModel.nsPerTick);
 
-    startTimeStamp = static_cast<uint64_t>(globalStartTS * frequency) + c0;
+    startTimeStamp = timeModel.toCpuTime(globalStartTS);
     endTimeStamp = startTimeStamp + cpuDuration;
     completeTimeStamp = startTimeStamp + cpuCompleteDuration;
 
@@ -319,6 +325,13 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
         startTimeStamp = contextStartTS;
         endTimeStamp = contextEndTS;
         completeTimeStamp = *contextCompleteTS;
+    } else if (TimelineTracer::isEnabled()) {
+        uint64_t osTimeNow = 0;
+        if (cmdQueue->getDevice().getOSTime()->getCpuTime(&osTimeNow)) {
+            // profiling timestamps are in OSTime CPU domain, shift them to the tracer clock
+            auto clockOffset = static_cast<int64_t>(TimelineTracer::getTimestampNs() - osTimeNow);
+            TimelineTracer::get().record("GPU execution", TimelineTrack::Gpu, startTimeStamp + clockOffset, cpuCompleteDuration, taskCount);
+        }
     }
 
     dataCalculated = true;
@@ -368,16 +381,42 @@ void Event::updateExecutionStatus() {
         // Note : Intentional fallthrough (no return) to check for CL_COMPLETE
     }
 
-    if ((cmdQueue != nullptr) && (cmdQueue->isCompleted(getCompletionStamp()))) {
+    if (cmdQueue == nullptr) {
+        transitionExecutionStatus(CL_SUBMITTED);
+        return;
+    }
+
+    auto &completionDispatcher = cmdQueue->getCommandStreamReceiver().getCompletionDispatcher();
+    auto hwTag = cmdQueue->getHwTag();
+    DEBUG_BREAK_IF(hwTag == Event::eventNotReady);
+    if (hwTag >= getCompletionStamp()) {
         transitionExecutionStatus(CL_COMPLETE);
         executeCallbacks(CL_COMPLETE);
         unblockEventsBlockedByThis(CL_COMPLETE);
         auto *allocationStorage = cmdQueue->getCommandStreamReceiver().getInternalAllocationStorage();
         allocationStorage->cleanAllocationList(this->taskCount, TEMPORARY_ALLOCATION);
+        // complete other events of this CSR that were reached by the same tag
+        completionDispatcher.dispatch(hwTag);
         return;
     }
 
     transitionExecutionStatus(CL_SUBMITTED);
+    completionDispatcher.dispatch(hwTag);
+    registerForCompletion();
+}
+
+void Event::registerForCompletion() {
+    auto completionStamp = getCompletionStamp();
+    if (completionStamp == Event::eventNotReady) {
+        return;
+    }
+    // only events with someone to notify need to be completed without being polled
+    if (!peekHasCallbacks() && !peekHasChildEvents()) {
+        return;
+    }
+    if (!registeredForCompletion) {
+        cmdQueue->getCommandStreamReceiver().getCompletionDispatcher().registerEvent(*this, completionStamp);
+    }
 }
 
 void Event::addChild(Event &childEvent) {
@@ -484,7 +523,7 @@ void Event::submitCommand(bool abortTasks) {
                 setSubmitTimeStamp();
                 setStartTimeStamp();
             } else {
-                this->cmdQueue->getDevice().getOSTime()->getCpuGpuTime(&submitTimeStamp);
+                this->cmdQueue->getDevice().getOSTime()->sampleCpuGpuTime(&submitTimeStamp);
             }
             if (perfCountersEnabled && perfCounterNode) {
                 this->cmdQueue->getCommandStreamReceiver().makeResident(*perfCounterNode->getBaseGraphicsAllocation());
@@ -516,12 +555,14 @@ cl_int Event::waitForEvents(cl_uint numEvents,
         return CL_SUCCESS;
     }
 
-    //flush all command queues
+    //flush all command queues, events from the same queue are usually adjacent
+    CommandQueue *lastFlushedQueue = nullptr;
     for (const cl_event *it = eventList, *end = eventList + numEvents; it != end; ++it) {
         Event *event = castToObjectOrAbort<Event>(*it);
-        if (event->cmdQueue) {
+        if (event->cmdQueue && event->cmdQueue != lastFlushedQueue) {
             if (event->taskLevel != Event::eventNotReady) {
                 event->cmdQueue->flush();
+                lastFlushedQueue = event->cmdQueue;
             }
         }
     }
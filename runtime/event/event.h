@@ -345,6 +345,12 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
     void submitCommand(bool abortBlockedTasks);
+    // lets the CSR complete this event once its task count is reached
+    void registerForCompletion();
+    // changed only under the lock of the completion dispatcher
+    std::atomic<bool> registeredForCompletion{false};
+    uint32_t registeredCompletionStamp = 0u;
+    friend class CompletionDispatcher;
 
     bool currentCmdQVirtualEvent;
     std::atomic<Command *> cmdToSubmit;
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace OCLRT {
+class Event;
+
+// Events of a single command stream receiver waiting for their task count,
+// min-heap on task count so the front event completes first
+class TaskCountEventHeap {
+  public:
+    struct Entry {
+        uint32_t taskCount;
+        Event *event;
+    };
+
+    void push(Event &event, uint32_t taskCount) {
+        entries.push_back({taskCount, &event});
+        std::push_heap(entries.begin(), entries.end(), Compare());
+    }
+
+    Entry pop() {
+        std::pop_heap(entries.begin(), entries.end(), Compare());
+        auto entry = entries.back();
+        entries.pop_back();
+        return entry;
+    }
+
+    const Entry &front() const { return entries.front(); }
+    bool empty() const { return entries.empty(); }
+    size_t size() const { return entries.size(); }
+    void clear() { entries.clear(); }
+
+    std::vector<Entry>::const_iterator begin() const { return entries.begin(); }
+    std::vector<Entry>::const_iterator end() const { return entries.end(); }
+
+  protected:
+    struct Compare {
+        bool operator()(const Entry &lhs, const Entry &rhs) const { return lhs.taskCount > rhs.taskCount; }
+    };
+
+    std::vector<Entry> entries;
+};
+} // namespace OCLRT
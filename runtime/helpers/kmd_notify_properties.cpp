@@ -7,8 +7,10 @@
 
 #include "runtime/helpers/kmd_notify_properties.h"
 
+#include "runtime/helpers/basic_math.h"
 #include "runtime/os_interface/debug_settings_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 
 using namespace OCLRT;
@@ -45,7 +47,72 @@ bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
         timeoutValueOutput = getBaseTimeout(multiplier);
     }
 
-    return (properties->enableKmdNotify || !acLineConnected);
+    bool enableTimeout = (properties->enableKmdNotify || !acLineConnected);
+
+    if (DebugManager.flags.EnableAdaptiveWait.get() == 1 && !maxPowerSavingMode) {
+        auto adaptiveTimeout = getAdaptiveSpinTimeout();
+        if (adaptiveTimeout >= 0) {
+            timeoutValueOutput = enableTimeout ? std::min(timeoutValueOutput, adaptiveTimeout) : adaptiveTimeout;
+            enableTimeout = true;
+        }
+    }
+
+    return enableTimeout;
+}
+
+int64_t KmdNotifyHelper::getAdaptiveSpinTimeout() const {
+    auto averageWait = averageWaitMicroseconds.load();
+    if (averageWait < 0) {
+        return -1;
+    }
+    // spinning through a long task only burns the core, sleep right away
+    if (averageWait > KmdNotifyConstants::adaptiveWaitMaximumSpinMicroseconds) {
+        return KmdNotifyConstants::adaptiveWaitMinimumSpinMicroseconds;
+    }
+    auto spinTimeout = averageWait * KmdNotifyConstants::adaptiveWaitSpinMultiplier;
+    return std::max(KmdNotifyConstants::adaptiveWaitMinimumSpinMicroseconds,
+                    std::min(spinTimeout, KmdNotifyConstants::adaptiveWaitMaximumSpinMicroseconds));
+}
+
+size_t KmdNotifyHelper::getHistogramBucket(int64_t microseconds) {
+    if (microseconds <= 0) {
+        return 0u;
+    }
+    auto bucket = static_cast<size_t>(Math::log2(static_cast<uint64_t>(microseconds))) + 1;
+    return std::min(bucket, waitTimeHistogramBuckets - 1);
+}
+
+void KmdNotifyHelper::recordWait(int64_t waitTimeMicroseconds, int64_t spinTimeMicroseconds, bool slept, bool completedBeforeWait) {
+    waits++;
+    if (slept) {
+        sleeps++;
+    }
+    waitTimeHistogram[getHistogramBucket(waitTimeMicroseconds)]++;
+    spinTimeHistogram[getHistogramBucket(spinTimeMicroseconds)]++;
+
+    // waits for already completed tasks say nothing about task duration
+    if (completedBeforeWait) {
+        return;
+    }
+    auto averageWait = averageWaitMicroseconds.load();
+    if (averageWait < 0) {
+        averageWait = waitTimeMicroseconds;
+    } else {
+        averageWait += (waitTimeMicroseconds - averageWait) / KmdNotifyConstants::adaptiveWaitAverageDivisor;
+    }
+    averageWaitMicroseconds.store(averageWait);
+}
+
+WaitStatistics KmdNotifyHelper::getWaitStatistics() const {
+    WaitStatistics statistics;
+    statistics.waits = waits.load();
+    statistics.sleeps = sleeps.load();
+    statistics.averageWaitMicroseconds = averageWaitMicroseconds.load();
+    for (size_t i = 0; i < waitTimeHistogramBuckets; i++) {
+        statistics.waitTimeHistogram[i] = waitTimeHistogram[i].load();
+        statistics.spinTimeHistogram[i] = spinTimeHistogram[i].load();
+    }
+    return statistics;
 }
 
 bool KmdNotifyHelper::applyQuickKmdSleepForSporadicWait() const {
@@ -8,6 +8,7 @@
 #pragma once
 #include "runtime/helpers/completion_stamp.h"
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -28,8 +29,26 @@ struct KmdNotifyProperties {
 namespace KmdNotifyConstants {
 constexpr int64_t timeoutInMicrosecondsForDisconnectedAcLine = 10000;
 constexpr uint32_t minimumTaskCountDiffToCheckAcLine = 10;
+constexpr int64_t adaptiveWaitMinimumSpinMicroseconds = 10;
+constexpr int64_t adaptiveWaitMaximumSpinMicroseconds = 1000;
+// spin budget is this multiple of the average wait time, to cover its variance
+constexpr int64_t adaptiveWaitSpinMultiplier = 2;
+// weight of the newest sample in the moving average is 1 / adaptiveWaitAverageDivisor
+constexpr int64_t adaptiveWaitAverageDivisor = 8;
 } // namespace KmdNotifyConstants
 
+// histogram bucket N counts waits that took [2^(N-1), 2^N) microseconds, bucket 0 counts waits below 1 microsecond
+constexpr size_t waitTimeHistogramBuckets = 24;
+using WaitTimeHistogram = std::array<uint64_t, waitTimeHistogramBuckets>;
+
+struct WaitStatistics {
+    uint64_t waits = 0u;
+    uint64_t sleeps = 0u;
+    int64_t averageWaitMicroseconds = -1;
+    WaitTimeHistogram waitTimeHistogram = {};
+    WaitTimeHistogram spinTimeHistogram = {};
+};
+
 class KmdNotifyHelper {
   public:
     KmdNotifyHelper() = delete;
@@ -47,6 +66,10 @@ class KmdNotifyHelper {
     MOCKABLE_VIRTUAL void updateLastWaitForCompletionTimestamp();
     MOCKABLE_VIRTUAL void updateAcLineStatus();
 
+    // waitTime covers the whole wait, spinTime only CPU polling before falling back to KMD wait
+    void recordWait(int64_t waitTimeMicroseconds, int64_t spinTimeMicroseconds, bool slept, bool completedBeforeWait);
+    WaitStatistics getWaitStatistics() const;
+
     static void overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination);
     static void overrideFromDebugVariable(int32_t debugVariableValue, bool &destination);
 
@@ -57,11 +80,19 @@ class KmdNotifyHelper {
   protected:
     bool applyQuickKmdSleepForSporadicWait() const;
     int64_t getBaseTimeout(const int64_t &multiplier) const;
+    int64_t getAdaptiveSpinTimeout() const;
     int64_t getMicrosecondsSinceEpoch() const;
+    static size_t getHistogramBucket(int64_t microseconds);
 
     const KmdNotifyProperties *properties = nullptr;
     std::atomic<int64_t> lastWaitForCompletionTimestampUs{0};
     std::atomic<bool> acLineConnected{true};
     bool maxPowerSavingMode = false;
+
+    std::atomic<int64_t> averageWaitMicroseconds{-1};
+    std::atomic<uint64_t> waits{0u};
+    std::atomic<uint64_t> sleeps{0u};
+    std::array<std::atomic<uint64_t>, waitTimeHistogramBuckets> waitTimeHistogram = {};
+    std::array<std::atomic<uint64_t>, waitTimeHistogramBuckets> spinTimeHistogram = {};
 };
 } // namespace OCLRT
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/striped_hash.h"
+
+#include "runtime/helpers/hash.h"
+#include "runtime/utilities/cpu_info.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OCLRT {
+
+StripedHash::UpdateStripesT StripedHash::updateStripes = StripedHash::updateStripesScalar;
+
+StripedHash::Initializer::Initializer() {
+    auto &cpuInfo = CpuInfo::getInstance();
+    if (cpuInfo.isFeatureSupported(CpuInfo::featureAvX2)) {
+        StripedHash::updateStripes = StripedHash::updateStripesAvx2;
+    } else if (cpuInfo.isFeatureSupported(CpuInfo::featureSsE41)) {
+        StripedHash::updateStripes = StripedHash::updateStripesSse4;
+    }
+}
+
+StripedHash::Initializer StripedHash::initializer;
+
+void StripedHash::updateStripesScalar(uint32_t *lanes, const char *data, size_t numStripes) {
+    for (size_t stripe = 0; stripe < numStripes; stripe++) {
+        for (size_t lane = 0; lane < numLanes; lane++) {
+            uint32_t input;
+            memcpy(&input, data + lane * sizeof(uint32_t), sizeof(uint32_t));
+            lanes[lane] = round(lanes[lane], input);
+        }
+        data += stripeSize;
+    }
+}
+
+void StripedHash::reset() {
+    for (size_t lane = 0; lane < numLanes; lane++) {
+        lanes[lane] = prime1 * static_cast<uint32_t>(lane + 1) + prime2;
+    }
+    pendingSize = 0;
+    totalSize = 0;
+}
+
+void StripedHash::update(const char *buff, size_t size) {
+    if (buff == nullptr) {
+        return;
+    }
+    totalSize += size;
+
+    if (pendingSize > 0) {
+        auto toCopy = std::min(size, stripeSize - pendingSize);
+        memcpy(pending + pendingSize, buff, toCopy);
+        pendingSize += toCopy;
+        buff += toCopy;
+        size -= toCopy;
+        if (pendingSize < stripeSize) {
+            return;
+        }
+        updateStripes(lanes, pending, 1);
+        pendingSize = 0;
+    }
+
+    auto numStripes = size / stripeSize;
+    if (numStripes > 0) {
+        updateStripes(lanes, buff, numStripes);
+        buff += numStripes * stripeSize;
+        size -= numStripes * stripeSize;
+    }
+
+    if (size > 0) {
+        memcpy(pending, buff, size);
+        pendingSize = size;
+    }
+}
+
+uint64_t StripedHash::finish() const {
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(lanes), sizeof(lanes));
+    hash.update(reinterpret_cast<const char *>(&totalSize), sizeof(totalSize));
+    hash.update(pending, pendingSize);
+    return hash.finish();
+}
+} // namespace OCLRT
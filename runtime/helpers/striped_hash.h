@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace OCLRT {
+// Incremental hash for large inputs (program sources, binaries).
+// Data is consumed in 32-byte stripes by 8 independent 32-bit lanes, which lets
+// the stripe loop run on SSE4/AVX2, the result does not depend on how the input
+// is split between update calls. Lanes are folded with Hash in finish().
+// Not compatible with Hash, must not be used for checksums stored in binaries.
+class StripedHash {
+  public:
+    static const size_t numLanes = 8;
+    static const size_t stripeSize = numLanes * sizeof(uint32_t);
+    static const uint32_t prime1 = 0x9E3779B1u;
+    static const uint32_t prime2 = 0x85EBCA77u;
+
+    using UpdateStripesT = void (*)(uint32_t *lanes, const char *data, size_t numStripes);
+
+    StripedHash() {
+        reset();
+    }
+
+    void reset();
+    void update(const char *buff, size_t size);
+    uint64_t finish() const;
+
+    static uint64_t hash(const char *buff, size_t size) {
+        StripedHash hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+    static void updateStripesScalar(uint32_t *lanes, const char *data, size_t numStripes);
+    static void updateStripesSse4(uint32_t *lanes, const char *data, size_t numStripes);
+    static void updateStripesAvx2(uint32_t *lanes, const char *data, size_t numStripes);
+
+    // selected once based on CPU capabilities
+    static UpdateStripesT updateStripes;
+
+  protected:
+    static uint32_t round(uint32_t lane, uint32_t input) {
+        lane += input * prime2;
+        lane = (lane << 13) | (lane >> 19);
+        return lane * prime1;
+    }
+
+    uint32_t lanes[numLanes];
+    char pending[stripeSize];
+    size_t pendingSize;
+    uint64_t totalSize;
+
+    struct Initializer {
+        Initializer();
+    };
+    static Initializer initializer;
+};
+} // namespace OCLRT
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "runtime/helpers/striped_hash.h"
+
+#include <immintrin.h>
+
+namespace OCLRT {
+
+void StripedHash::updateStripesAvx2(uint32_t *lanes, const char *data, size_t numStripes) {
+    const __m256i prime1 = _mm256_set1_epi32(static_cast<int>(StripedHash::prime1));
+    const __m256i prime2 = _mm256_set1_epi32(static_cast<int>(StripedHash::prime2));
+    auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lanes)); //AVX
+    for (size_t stripe = 0; stripe < numStripes; stripe++) {
+        auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)); //AVX
+        value = _mm256_add_epi32(value, _mm256_mullo_epi32(input, prime2));
+        value = _mm256_or_si256(_mm256_slli_epi32(value, 13), _mm256_srli_epi32(value, 19));
+        value = _mm256_mullo_epi32(value, prime1);
+        data += stripeSize;
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), value); //AVX
+}
+} // namespace OCLRT
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/striped_hash.h"
+
+#include <immintrin.h>
+
+namespace OCLRT {
+
+static inline __m128i roundSse4(__m128i lanes, __m128i input) {
+    const __m128i prime1 = _mm_set1_epi32(static_cast<int>(StripedHash::prime1));
+    const __m128i prime2 = _mm_set1_epi32(static_cast<int>(StripedHash::prime2));
+    lanes = _mm_add_epi32(lanes, _mm_mullo_epi32(input, prime2)); //SSE4.1
+    lanes = _mm_or_si128(_mm_slli_epi32(lanes, 13), _mm_srli_epi32(lanes, 19));
+    return _mm_mullo_epi32(lanes, prime1); //SSE4.1
+}
+
+void StripedHash::updateStripesSse4(uint32_t *lanes, const char *data, size_t numStripes) {
+    auto lanesLo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+    auto lanesHi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes + 4));
+    for (size_t stripe = 0; stripe < numStripes; stripe++) {
+        auto inputLo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+        auto inputHi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16));
+        lanesLo = roundSse4(lanesLo, inputLo);
+        lanesHi = roundSse4(lanesHi, inputHi);
+        data += stripeSize;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), lanesLo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes + 4), lanesHi);
+}
+} // namespace OCLRT
@@ -99,9 +99,7 @@ CommandComputeKernel::CommandComputeKernel(CommandQueue &commandQueue, std::uniq
     : commandQueue(commandQueue), kernelOperation(std::move(kernelOperation)), flushDC(flushDC), slmUsed(usesSLM),
       NDRangeKernel(ndRangeKernel), printfHandler(std::move(printfHandler)), kernel(kernel),
       kernelCount(kernelCount), preemptionMode(preemptionMode) {
-    for (auto surface : surfaces) {
-        this->surfaces.push_back(surface);
-    }
+    this->surfaces.assign(surfaces.begin(), surfaces.end());
     UNRECOVERABLE_IF(nullptr == this->kernel);
     kernel->incRefInternal();
 }
@@ -123,6 +121,7 @@ CommandComputeKernel::~CommandComputeKernel() {
             event->decRefInternal();
         }
     }
+    commandQueue.releaseKernelOperation(std::move(kernelOperation));
 }
 
 CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminated) {
@@ -227,6 +226,7 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
                                                       taskLevel,
                                                       dispatchFlags,
                                                       commandQueue.getDevice());
+    kernelOperation->taskCount = completionStamp.taskCount;
 
     commandQueue.waitUntilComplete(completionStamp.taskCount, completionStamp.flushStamp, false);
     if (printfHandler) {
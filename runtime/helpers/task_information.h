@@ -83,6 +83,8 @@ struct KernelOperation {
     size_t surfaceStateHeapSizeEM;
     bool doNotFreeISH;
     InternalAllocationStorage &storageForAllocations;
+    // task count of the last submission using the resources, they can be reused once it is completed
+    uint32_t taskCount = 0u;
 };
 
 class CommandComputeKernel : public Command {
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/indirect_heap/indirect_heap_ring.h"
+
+#include "runtime/indirect_heap/indirect_heap.h"
+
+namespace OCLRT {
+
+void IndirectHeapRing::reset(size_t reservedSize) {
+    segments.clear();
+    this->reservedSize = reservedSize;
+    recordedOffset = reservedSize;
+    lap = 0u;
+}
+
+void IndirectHeapRing::recordSubmission(const IndirectHeap &heap, uint32_t taskCount, uint32_t completedTaskCount) {
+    for (auto it = segments.rbegin(); it != segments.rend() && it->taskCount == pendingTaskCount; ++it) {
+        it->taskCount = taskCount;
+    }
+
+    auto used = heap.getUsed();
+    if (used > recordedOffset) {
+        if (!segments.empty() && segments.back().lap == lap && segments.back().end == recordedOffset && segments.back().taskCount == taskCount) {
+            segments.back().end = used;
+        } else {
+            segments.push_back({recordedOffset, used, taskCount, lap});
+        }
+        recordedOffset = used;
+    }
+    retireCompletedSegments(completedTaskCount);
+}
+
+bool IndirectHeapRing::reserveSpace(IndirectHeap &heap, size_t minRequiredSize, uint32_t completedTaskCount) {
+    retireCompletedSegments(completedTaskCount);
+
+    auto used = heap.getUsed();
+    auto maxAvailableSpace = heap.getMaxAvailableSpace();
+    if (used + minRequiredSize <= getSpaceLimit(maxAvailableSpace)) {
+        return true;
+    }
+
+    bool previousLapInFlight = !segments.empty() && segments.front().lap != lap;
+    if (previousLapInFlight) {
+        return false;
+    }
+
+    bool notSubmittedDataPresent = used > recordedOffset;
+    size_t limitAfterWrap = maxAvailableSpace;
+    if (!segments.empty()) {
+        limitAfterWrap = segments.front().start;
+    } else if (notSubmittedDataPresent) {
+        limitAfterWrap = recordedOffset;
+    }
+    if (reservedSize + minRequiredSize > limitAfterWrap) {
+        return false;
+    }
+
+    // data written since the last submission will be consumed by the next task
+    if (notSubmittedDataPresent) {
+        segments.push_back({recordedOffset, used, pendingTaskCount, lap});
+    }
+    lap++;
+    recordedOffset = reservedSize;
+    heap.replaceBuffer(heap.getCpuBase(), maxAvailableSpace);
+    heap.getSpace(reservedSize);
+    return true;
+}
+
+void IndirectHeapRing::retireCompletedSegments(uint32_t completedTaskCount) {
+    while (!segments.empty() && segments.front().taskCount != pendingTaskCount && segments.front().taskCount <= completedTaskCount) {
+        segments.pop_front();
+    }
+}
+
+size_t IndirectHeapRing::getSpaceLimit(size_t maxAvailableSpace) const {
+    if (!segments.empty() && segments.front().lap != lap) {
+        return segments.front().start;
+    }
+    return maxAvailableSpace;
+}
+
+} // namespace OCLRT
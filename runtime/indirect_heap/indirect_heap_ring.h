@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+
+namespace OCLRT {
+class IndirectHeap;
+
+// Tracks which parts of an indirect heap are still referenced by in-flight tasks,
+// so that a full heap can wrap around within the same allocation instead of being
+// swapped for a new one (which would force state base address reprogramming).
+class IndirectHeapRing {
+  public:
+    static constexpr uint32_t pendingTaskCount = std::numeric_limits<uint32_t>::max();
+
+    struct Segment {
+        size_t start;
+        size_t end;
+        uint32_t taskCount;
+        uint64_t lap;
+    };
+
+    void reset(size_t reservedSize);
+    void recordSubmission(const IndirectHeap &heap, uint32_t taskCount, uint32_t completedTaskCount);
+    bool reserveSpace(IndirectHeap &heap, size_t minRequiredSize, uint32_t completedTaskCount);
+
+    size_t getSegmentsCount() const { return segments.size(); }
+    uint64_t peekLap() const { return lap; }
+
+  protected:
+    void retireCompletedSegments(uint32_t completedTaskCount);
+    size_t getSpaceLimit(size_t maxAvailableSpace) const;
+
+    std::deque<Segment> segments;
+    size_t reservedSize = 0u;
+    size_t recordedOffset = 0u;
+    uint64_t lap = 0u;
+};
+} // namespace OCLRT
@@ -8,6 +8,7 @@
 #include "runtime/memory_manager/internal_allocation_storage.h"
 
 #include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/helpers/basic_math.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/os_interface/os_context.h"
 
@@ -29,13 +30,88 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
             return;
         }
     }
-    auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
-    allocationsList.pushTailOne(*gfxAllocation.release());
+    if (allocationUsage == TEMPORARY_ALLOCATION) {
+        temporaryAllocations.pushTailOne(*gfxAllocation.release());
+    } else {
+        storeReusableAllocation(*gfxAllocation.release(), taskCount);
+    }
 }
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
-    freeAllocationsList(waitTaskCount, (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse);
+    if (allocationUsage == TEMPORARY_ALLOCATION) {
+        freeAllocationsList(waitTaskCount, temporaryAllocations);
+    } else {
+        freeReusableAllocations(waitTaskCount);
+    }
+}
+
+uint32_t InternalAllocationStorage::getSizeClass(size_t size) {
+    return size == 0 ? 0u : static_cast<uint32_t>(Math::log2(static_cast<uint64_t>(size)));
+}
+
+void InternalAllocationStorage::storeReusableAllocation(GraphicsAllocation &gfxAllocation, uint32_t taskCount) {
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(reuseBucketsMutex);
+
+    allocationsForReuse.pushTailOne(gfxAllocation);
+
+    auto &bucket = reuseBuckets[{gfxAllocation.getAllocationType(), getSizeClass(gfxAllocation.getUnderlyingBufferSize())}];
+    auto position = bucket.end();
+    while (position != bucket.begin() && std::prev(position)->taskCount > taskCount) {
+        --position;
+    }
+    bucket.insert(position, {&gfxAllocation, taskCount, now});
+
+    trimReusableAllocations(now);
+}
+
+void InternalAllocationStorage::freeReusableAllocations(uint32_t waitTaskCount) {
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    std::lock_guard<std::mutex> lock(reuseBucketsMutex);
+
+    for (auto bucket = reuseBuckets.begin(); bucket != reuseBuckets.end();) {
+        auto &allocations = bucket->second;
+        for (auto entry = allocations.begin(); entry != allocations.end();) {
+            if (entry->allocation->getTaskCount(contextId) <= waitTaskCount) {
+                memoryManager->freeGraphicsMemory(allocationsForReuse.removeOne(*entry->allocation).release());
+                entry = allocations.erase(entry);
+            } else {
+                ++entry;
+            }
+        }
+        bucket = allocations.empty() ? reuseBuckets.erase(bucket) : std::next(bucket);
+    }
+}
+
+void InternalAllocationStorage::trimReusableAllocations(std::chrono::steady_clock::time_point now) {
+    auto trimTimeout = DebugManager.flags.ReusableAllocationsTrimTimeoutMs.get();
+    if (trimTimeout <= 0) {
+        return;
+    }
+    const auto idleTime = std::chrono::milliseconds(trimTimeout);
+    if (now - lastTrimTime < idleTime) {
+        return;
+    }
+    lastTrimTime = now;
+
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    auto currentTagValue = *commandStreamReceiver.getTagAddress();
+
+    for (auto bucket = reuseBuckets.begin(); bucket != reuseBuckets.end();) {
+        auto &allocations = bucket->second;
+        for (auto entry = allocations.begin(); entry != allocations.end();) {
+            if (now - entry->storeTime >= idleTime && currentTagValue >= entry->allocation->getTaskCount(contextId)) {
+                memoryManager->freeGraphicsMemory(allocationsForReuse.removeOne(*entry->allocation).release());
+                entry = allocations.erase(entry);
+            } else {
+                ++entry;
+            }
+        }
+        bucket = allocations.empty() ? reuseBuckets.erase(bucket) : std::next(bucket);
+    }
 }
 
 void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList) {
@@ -59,8 +135,28 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
-    auto allocation = allocationsForReuse.detachAllocation(requiredSize, commandStreamReceiver, allocationType);
-    return allocation;
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    std::lock_guard<std::mutex> lock(reuseBucketsMutex);
+
+    // every allocation from a higher size class fits, only the first bucket needs size checks
+    for (auto bucket = reuseBuckets.lower_bound({allocationType, getSizeClass(requiredSize)});
+         bucket != reuseBuckets.end() && bucket->first.first == allocationType; ++bucket) {
+        auto &allocations = bucket->second;
+        for (auto entry = allocations.begin(); entry != allocations.end(); ++entry) {
+            if (*commandStreamReceiver.getTagAddress() < entry->allocation->getTaskCount(contextId)) {
+                break;
+            }
+            if (entry->allocation->getUnderlyingBufferSize() >= requiredSize) {
+                auto allocation = entry->allocation;
+                allocations.erase(entry);
+                if (allocations.empty()) {
+                    reuseBuckets.erase(bucket);
+                }
+                return allocationsForReuse.removeOne(*allocation);
+            }
+        }
+    }
+    return nullptr;
 }
 
 struct ReusableAllocationRequirements {
@@ -8,6 +8,12 @@
 #pragma once
 #include "runtime/memory_manager/allocations_list.h"
 
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+
 namespace OCLRT {
 class CommandStreamReceiver;
 
@@ -23,10 +29,28 @@ class InternalAllocationStorage {
     AllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
 
   protected:
+    struct ReusableAllocation {
+        GraphicsAllocation *allocation;
+        uint32_t taskCount;
+        std::chrono::steady_clock::time_point storeTime;
+    };
+    // allocations for reuse indexed by type and power-of-two size class (floor of log2 of size),
+    // each bucket is ordered by task count so completed allocations are at its front
+    using ReuseBucketKey = std::pair<GraphicsAllocation::AllocationType, uint32_t>;
+    using ReuseBuckets = std::map<ReuseBucketKey, std::deque<ReusableAllocation>>;
+
+    static uint32_t getSizeClass(size_t size);
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
+    void storeReusableAllocation(GraphicsAllocation &gfxAllocation, uint32_t taskCount);
+    void freeReusableAllocations(uint32_t waitTaskCount);
+    void trimReusableAllocations(std::chrono::steady_clock::time_point now);
     CommandStreamReceiver &commandStreamReceiver;
 
     AllocationsList temporaryAllocations;
     AllocationsList allocationsForReuse;
+
+    std::mutex reuseBucketsMutex;
+    ReuseBuckets reuseBuckets;
+    std::chrono::steady_clock::time_point lastTrimTime = std::chrono::steady_clock::now();
 };
 } // namespace OCLRT
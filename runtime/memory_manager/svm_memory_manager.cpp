@@ -47,35 +47,61 @@ GraphicsAllocation *SVMAllocsManager::MapBasedAllocationTracker::get(const void
     return nullptr;
 }
 
-SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager) : memoryManager(memoryManager) {
+uint64_t SVMAllocsManager::getNextGeneration() {
+    static std::atomic<uint64_t> generationCounter{0u};
+    return ++generationCounter;
+}
+
+SVMAllocsManager::LookupCache &SVMAllocsManager::getLookupCache() {
+    static thread_local LookupCache lookupCache;
+    return lookupCache;
+}
+
+SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager) : memoryManager(memoryManager), generation(getNextGeneration()) {
 }
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, bool coherent, bool readOnly) {
     if (size == 0)
         return nullptr;
 
-    std::unique_lock<std::mutex> lock(mtx);
     GraphicsAllocation *GA = memoryManager->allocateGraphicsMemoryWithProperties({size, GraphicsAllocation::AllocationType::SVM});
     if (!GA) {
         return nullptr;
     }
     GA->setMemObjectsAllocationWithWritableFlags(!readOnly);
     GA->setCoherent(coherent);
+
+    std::unique_lock<std::shared_timed_mutex> lock(mtx);
     this->SVMAllocs.insert(*GA);
 
     return GA->getUnderlyingBuffer();
 }
 
 GraphicsAllocation *SVMAllocsManager::getSVMAlloc(const void *ptr) {
-    std::unique_lock<std::mutex> lock(mtx);
-    return SVMAllocs.get(ptr);
+    auto &lookupCache = getLookupCache();
+    if (lookupCache.generation == generation.load(std::memory_order_acquire) &&
+        ptr >= lookupCache.begin && ptr < lookupCache.end) {
+        return lookupCache.allocation;
+    }
+
+    std::shared_lock<std::shared_timed_mutex> lock(mtx);
+    GraphicsAllocation *GA = SVMAllocs.get(ptr);
+    if (GA) {
+        lookupCache.generation = generation.load(std::memory_order_relaxed);
+        lookupCache.begin = GA->getUnderlyingBuffer();
+        lookupCache.end = ptrOffset(GA->getUnderlyingBuffer(), GA->getUnderlyingBufferSize());
+        lookupCache.allocation = GA;
+    }
+    return GA;
 }
 
 void SVMAllocsManager::freeSVMAlloc(void *ptr) {
-    GraphicsAllocation *GA = getSVMAlloc(ptr);
+    std::unique_lock<std::shared_timed_mutex> lock(mtx);
+    GraphicsAllocation *GA = SVMAllocs.get(ptr);
     if (GA) {
-        std::unique_lock<std::mutex> lock(mtx);
         SVMAllocs.remove(*GA);
+        generation.store(getNextGeneration(), std::memory_order_release);
+        lock.unlock();
         memoryManager->freeGraphicsMemory(GA);
     }
 }
@@ -8,9 +8,10 @@
 #pragma once
 #include "CL/cl.h"
 
+#include <atomic>
 #include <cstdint>
 #include <map>
-#include <mutex>
+#include <shared_mutex>
 
 namespace OCLRT {
 class Device;
@@ -31,6 +32,15 @@ class SVMAllocsManager {
         std::map<const void *, GraphicsAllocation *> allocs;
     };
 
+    // Per-thread cache of the last successful lookup. It is valid only as long as the owning
+    // manager's generation is unchanged; generations are unique across all managers.
+    struct LookupCache {
+        uint64_t generation = 0u;
+        const void *begin = nullptr;
+        const void *end = nullptr;
+        GraphicsAllocation *allocation = nullptr;
+    };
+
     SVMAllocsManager(MemoryManager *memoryManager);
     void *createSVMAlloc(size_t size, bool coherent, bool readOnly);
     GraphicsAllocation *getSVMAlloc(const void *ptr);
@@ -39,8 +49,13 @@ class SVMAllocsManager {
     static bool memFlagIsReadOnly(cl_svm_mem_flags flags);
 
   protected:
+    static uint64_t getNextGeneration();
+    static LookupCache &getLookupCache();
+
     MapBasedAllocationTracker SVMAllocs;
     MemoryManager *memoryManager;
-    std::mutex mtx;
+    std::shared_timed_mutex mtx;
+    // changed under exclusive lock whenever an allocation is removed
+    std::atomic<uint64_t> generation;
 };
 } // namespace OCLRT
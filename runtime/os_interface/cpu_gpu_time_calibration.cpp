@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/cpu_gpu_time_calibration.h"
+
+#include "runtime/os_interface/os_time.h"
+
+#include <cmath>
+
+namespace OCLRT {
+
+constexpr size_t CpuGpuTimeCalibration::maxSamples;
+constexpr uint64_t CpuGpuTimeCalibration::minSampleIntervalNs;
+constexpr uint64_t CpuGpuTimeCalibration::minFitSpanNs;
+constexpr double CpuGpuTimeCalibration::maxRateDeviation;
+
+uint64_t CpuGpuTimeModel::toCpuTime(uint64_t gpuTicks) const {
+    auto deltaTicks = static_cast<double>(static_cast<int64_t>(gpuTicks - referenceGpuTicks));
+    return referenceCpuTime + static_cast<uint64_t>(static_cast<int64_t>(std::llround(deltaTicks * nsPerTick)));
+}
+
+void CpuGpuTimeCalibration::addSample(const TimeStampData &timeStamp) {
+    Sample sample = {timeStamp.GPUTimeStamp, timeStamp.CPUTimeinNS};
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!samples.empty()) {
+        if (sample.cpuTimeNs < samples.back().cpuTimeNs) {
+            // sampled concurrently and added late, newer data is already present
+            return;
+        }
+        if (sample.gpuTicks < samples.back().gpuTicks) {
+            // GPU timestamp counter was reset, older samples belong to a different timeline
+            samples.clear();
+        }
+    }
+
+    // the most recent sample is always kept, it replaces the previous one until that is far enough from its predecessor
+    auto count = samples.size();
+    if (count >= 2 && samples[count - 1].cpuTimeNs - samples[count - 2].cpuTimeNs < minSampleIntervalNs) {
+        samples.back() = sample;
+        return;
+    }
+    samples.push_back(sample);
+    if (samples.size() > maxSamples) {
+        samples.pop_front();
+    }
+}
+
+bool CpuGpuTimeCalibration::getModel(double nominalNsPerTick, CpuGpuTimeModel &model) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (samples.empty()) {
+        return false;
+    }
+
+    model.nsPerTick = nominalNsPerTick;
+    model.referenceGpuTicks = samples.back().gpuTicks;
+    model.referenceCpuTime = samples.back().cpuTimeNs;
+
+    if (samples.back().cpuTimeNs - samples.front().cpuTimeNs < minFitSpanNs) {
+        return true;
+    }
+
+    // least squares fit, values relative to the oldest sample to keep double precision
+    auto &origin = samples.front();
+    double meanTicks = 0.0;
+    double meanNs = 0.0;
+    for (auto &sample : samples) {
+        meanTicks += static_cast<double>(sample.gpuTicks - origin.gpuTicks);
+        meanNs += static_cast<double>(sample.cpuTimeNs - origin.cpuTimeNs);
+    }
+    meanTicks /= samples.size();
+    meanNs /= samples.size();
+
+    double covariance = 0.0;
+    double variance = 0.0;
+    for (auto &sample : samples) {
+        auto ticks = static_cast<double>(sample.gpuTicks - origin.gpuTicks) - meanTicks;
+        auto ns = static_cast<double>(sample.cpuTimeNs - origin.cpuTimeNs) - meanNs;
+        covariance += ticks * ns;
+        variance += ticks * ticks;
+    }
+    if (variance == 0.0) {
+        return true;
+    }
+
+    auto nsPerTick = covariance / variance;
+    if (std::fabs(nsPerTick - nominalNsPerTick) > nominalNsPerTick * maxRateDeviation) {
+        // clocks do not drift that much, samples are not reliable
+        return true;
+    }
+
+    // fitted line passes through the mean of samples
+    model.nsPerTick = nsPerTick;
+    model.referenceGpuTicks = origin.gpuTicks;
+    model.referenceCpuTime = origin.cpuTimeNs + static_cast<uint64_t>(static_cast<int64_t>(std::llround(meanNs - meanTicks * nsPerTick)));
+    return true;
+}
+
+size_t CpuGpuTimeCalibration::getSamplesCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return samples.size();
+}
+} // namespace OCLRT
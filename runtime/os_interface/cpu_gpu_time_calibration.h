@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace OCLRT {
+struct TimeStampData;
+
+// Linear mapping of GPU timestamp ticks to CPU time: cpuTime = referenceCpuTime + (gpuTicks - referenceGpuTicks) * nsPerTick
+struct CpuGpuTimeModel {
+    uint64_t toCpuTime(uint64_t gpuTicks) const;
+
+    double nsPerTick;
+    uint64_t referenceGpuTicks;
+    uint64_t referenceCpuTime;
+};
+
+// Fits CpuGpuTimeModel to CPU/GPU time pairs sampled over the lifetime of a device, so that
+// GPU timestamps of all events map onto one CPU timeline which follows the drift between both clocks.
+class CpuGpuTimeCalibration {
+  public:
+    void addSample(const TimeStampData &sample);
+    bool getModel(double nominalNsPerTick, CpuGpuTimeModel &model);
+
+    size_t getSamplesCount();
+
+    static constexpr size_t maxSamples = 16u;
+    static constexpr uint64_t minSampleIntervalNs = 10000000u;
+    static constexpr uint64_t minFitSpanNs = 100000000u;
+    static constexpr double maxRateDeviation = 0.01;
+
+  protected:
+    struct Sample {
+        uint64_t gpuTicks;
+        uint64_t cpuTimeNs;
+    };
+
+    std::mutex mutex;
+    std::deque<Sample> samples;
+};
+} // namespace OCLRT
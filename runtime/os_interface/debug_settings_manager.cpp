@@ -15,6 +15,7 @@
 #include "runtime/kernel/kernel.h"
 #include "runtime/mem_obj/mem_obj.h"
 #include "runtime/os_interface/definitions/translate_debug_settings.h"
+#include "runtime/utilities/binary_log.h"
 #include "runtime/utilities/debug_settings_reader_creator.h"
 
 #include "CL/cl.h"
@@ -50,6 +51,27 @@ void DebugSettingsManager<DebugLevel>::writeToFile(std::string filename, const c
 template <DebugFunctionalityLevel DebugLevel>
 DebugSettingsManager<DebugLevel>::~DebugSettingsManager() = default;
 
+template <DebugFunctionalityLevel DebugLevel>
+BinaryLogWriter *DebugSettingsManager<DebugLevel>::getBinaryLogWriter() {
+    // writer thread is started on first use, not while the library is being loaded
+    std::call_once(binaryLogWriterCreated, [this] { binaryLogWriter = createBinaryLogWriter(); });
+    return binaryLogWriter.get();
+}
+
+template <DebugFunctionalityLevel DebugLevel>
+std::unique_ptr<BinaryLogWriter> DebugSettingsManager<DebugLevel>::createBinaryLogWriter() {
+    auto binaryLogFileName = logFileName + ".bin";
+    return std::unique_ptr<BinaryLogWriter>(new BinaryLogWriter(std::unique_ptr<std::ostream>(new std::ofstream(binaryLogFileName, std::ios::binary | std::ios::trunc))));
+}
+
+template <DebugFunctionalityLevel DebugLevel>
+void DebugSettingsManager<DebugLevel>::logBinaryMessage(const std::string &message) {
+    if (false == debugLoggingAvailable()) {
+        return;
+    }
+    getBinaryLogWriter()->logMessage(message);
+}
+
 template <DebugFunctionalityLevel DebugLevel>
 void DebugSettingsManager<DebugLevel>::getHardwareInfoOverride(std::string &hwInfoConfig) {
     std::string str = flags.HardwareInfoOverride.get();
@@ -80,6 +102,10 @@ void DebugSettingsManager<DebugLevel>::logApiCall(const char *function, bool ent
     }
 
     if (flags.LogApiCalls.get()) {
+        if (flags.EnableBinaryLogging.get()) {
+            getBinaryLogWriter()->logApiCall(function, enter, errorCode);
+            return;
+        }
         std::unique_lock<std::mutex> theLock(mtx);
         std::thread::id thisThread = std::this_thread::get_id();
 
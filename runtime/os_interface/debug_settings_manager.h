@@ -8,6 +8,7 @@
 #pragma once
 #include <condition_variable>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <stdint.h>
@@ -41,6 +42,7 @@ void printDebugString(bool showDebugLogs, Args &&... args) {
 #define NO_SANITIZE
 #endif
 
+class BinaryLogWriter;
 class Kernel;
 class GraphicsAllocation;
 struct MultiDispatchInfo;
@@ -115,6 +117,7 @@ class DebugSettingsManager {
     const std::string getMemObjects(const uintptr_t *input, uint32_t numOfObjects);
 
     MOCKABLE_VIRTUAL void writeToFile(std::string filename, const char *str, size_t length, std::ios_base::openmode mode);
+    void logBinaryMessage(const std::string &message);
 
     void dumpBinaryProgram(int32_t numDevices, const size_t *lengths, const unsigned char **binaries);
     void dumpKernelArgs(const Kernel *kernel);
@@ -171,6 +174,12 @@ class DebugSettingsManager {
     void logInputs(Types &&... params) {
         if (debugLoggingAvailable()) {
             if (this->flags.LogApiCalls.get()) {
+                if (this->flags.EnableBinaryLogging.get()) {
+                    std::stringstream ss;
+                    printInputs(ss, params...);
+                    logBinaryMessage(ss.str());
+                    return;
+                }
                 std::unique_lock<std::mutex> theLock(mtx);
                 std::thread::id thisThread = std::this_thread::get_id();
                 std::stringstream ss;
@@ -195,6 +204,12 @@ class DebugSettingsManager {
     void log(bool enableLog, Types... params) {
         if (debugLoggingAvailable()) {
             if (enableLog) {
+                if (this->flags.EnableBinaryLogging.get()) {
+                    std::stringstream ss;
+                    print(ss, params...);
+                    logBinaryMessage(ss.str());
+                    return;
+                }
                 std::unique_lock<std::mutex> theLock(mtx);
                 std::thread::id thisThread = std::this_thread::get_id();
                 std::stringstream ss;
@@ -224,9 +239,14 @@ class DebugSettingsManager {
     const char *getAllocationTypeString(GraphicsAllocation const *graphicsAllocation);
 
   protected:
+    BinaryLogWriter *getBinaryLogWriter();
+    MOCKABLE_VIRTUAL std::unique_ptr<BinaryLogWriter> createBinaryLogWriter();
+
     std::unique_ptr<SettingsReader> readerImpl;
     std::mutex mtx;
     std::string logFileName;
+    std::once_flag binaryLogWriterCreated;
+    std::unique_ptr<BinaryLogWriter> binaryLogWriter;
 
     // Required for variadic template with 0 args passed
     void printInputs(std::stringstream &ss) {}
@@ -112,6 +112,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Cs
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideDefaultFP64Settings, -1, "-1: dont override, 0: disable, 1: enable.")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedBuffersEnabled, -1, "-1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideGemCloseWorkerQueueLimit, -1, "-1: dont override, 0: unlimited, >0: number of buffer objects waiting for gem close after which releasing thread blocks")
+DECLARE_DEBUG_VARIABLE(int32_t, ReusableAllocationsTrimTimeoutMs, 0, "0: disabled, >0: completed allocations kept for reuse longer than given number of milliseconds are released")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveWait, 0, "0: disabled, 1: enabled. CPU polling time before KMD wait follows average wait time observed by command stream receiver")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelKernelParsingThreads, -1, "-1: default - sequential, 0, 1: sequential, >1: number of threads parsing kernels of a gen binary")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIndirectHeapRing, -1, "-1: default - enabled, 0: disabled, 1: enabled. Full indirect heaps wrap around once GPU completed tasks using their beginning")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedSubmissionTargetLatencyUs, 0, "0: disabled, >0: number of command buffers merged into single exec in batched dispatch mode adapts to keep submission time below given value")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTimelineTrace, 0, "0: disabled, 1: record API calls, enqueues, flushes, waits and GPU execution of profiled events into a Chrome trace JSON written at exit")
+DECLARE_DEBUG_VARIABLE(std::string, TimelineTraceFile, std::string("timeline_trace.json"), "Name of file to save timeline trace into")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBinaryLogging, 0, "0: disabled, 1: LogApiCalls and debug messages are stored as binary records in per-thread buffers and written to <log file>.bin by a background thread, decode with ocloc decode_log")
 
 /*DRIVER TOGGLES*/
 DECLARE_DEBUG_VARIABLE(int32_t, ForceOCLVersion, 0, "Force specific OpenCL API version")
@@ -114,11 +114,16 @@ void BufferObject::processRelocs(int &idx, uint32_t drmContextId, ResidencyVecto
     }
 }
 
-int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, ResidencyVector &residency, drm_i915_gem_exec_object2 *execObjectsStorage) {
+int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, ResidencyVector &residency, drm_i915_gem_exec_object2 *execObjectsStorage,
+                       bool reuseResidencyExecObjects) {
     drm_i915_gem_execbuffer2 execbuf = {};
 
     int idx = 0;
-    processRelocs(idx, drmContextId, residency, execObjectsStorage);
+    if (reuseResidencyExecObjects) {
+        idx = static_cast<int>(residency.size());
+    } else {
+        processRelocs(idx, drmContextId, residency, execObjectsStorage);
+    }
     this->fillExecObject(execObjectsStorage[idx], drmContextId);
     idx++;
 
@@ -6,6 +6,9 @@
  */
 
 #pragma once
+#include "engine_node.h"
+
+#include <array>
 #include <atomic>
 #include <cstdlib>
 #include <errno.h>
@@ -42,7 +45,10 @@ class BufferObject {
 
     MOCKABLE_VIRTUAL int pin(BufferObject *const boToPin[], size_t numberOfBos, uint32_t drmContextId);
 
-    int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, ResidencyVector &residency, drm_i915_gem_exec_object2 *execObjectsStorage);
+    // When reuseResidencyExecObjects is set, execObjectsStorage already holds exec objects filled for this residency
+    // by a previous exec and only the batch buffer entry is written.
+    int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, uint32_t drmContextId, ResidencyVector &residency, drm_i915_gem_exec_object2 *execObjectsStorage,
+             bool reuseResidencyExecObjects = false);
 
     int wait(int64_t timeoutNs);
     bool close();
@@ -65,6 +71,15 @@ class BufferObject {
     void setAllocationType(StorageAllocatorType allocatorType) { this->storageAllocatorType = allocatorType; }
     bool peekIsReusableAllocation() { return this->isReused; }
 
+    // Returns false if bo was already added to the residency list with this generation in given os context
+    bool markForResidency(uint32_t osContextId, uint64_t residencyGeneration) {
+        if (residencyGenerations[osContextId] == residencyGeneration) {
+            return false;
+        }
+        residencyGenerations[osContextId] = residencyGeneration;
+        return true;
+    }
+
   protected:
     BufferObject(Drm *drm, int handle, bool isAllocated);
 
@@ -90,5 +105,6 @@ class BufferObject {
     bool isAllocated = false;
     uint64_t unmapSize = 0;
     StorageAllocatorType storageAllocatorType = UNKNOWN_ALLOCATOR;
+    std::array<uint64_t, maxOsContextCount> residencyGenerations = {};
 };
 } // namespace OCLRT
@@ -51,9 +51,18 @@ class DrmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
 
   protected:
     void makeResident(BufferObject *bo);
+    void clearResidency();
+    bool canReuseExecObjects(uint32_t drmContextId);
 
     std::vector<BufferObject *> residency;
+    // bumped whenever residency is cleared, lets reusable bos check for duplicates in O(1)
+    uint64_t residencyGeneration = 1u;
     std::vector<drm_i915_gem_exec_object2> execObjectsStorage;
+
+    // residency of the last exec, its exec objects are still filled in execObjectsStorage
+    std::vector<BufferObject *> submittedResidency;
+    uint32_t submittedDrmContextId = 0u;
+    uint64_t submittedReleasedBufferObjectsCount = 0u;
     Drm *drm;
     gemCloseWorkerMode gemCloseWorkerOperationMode;
 };
@@ -35,6 +35,7 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(const HardwareInfo
     this->drm = executionEnvironment.osInterface->get()->getDrm();
 
     residency.reserve(512);
+    submittedResidency.reserve(512);
     execObjectsStorage.reserve(512);
 
     executionEnvironment.osInterface->get()->setDrm(this->drm);
@@ -63,14 +64,21 @@ FlushStamp DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer,
             this->execObjectsStorage.resize(requiredSize);
         }
 
+        auto drmContextId = static_cast<OsContextLinux *>(osContext)->getDrmContextId();
+        bool reuseExecObjects = this->canReuseExecObjects(drmContextId);
+
         bb->exec(static_cast<uint32_t>(alignUp(batchBuffer.usedSize - batchBuffer.startOffset, 8)),
                  alignedStart, engineFlag | I915_EXEC_NO_RELOC,
                  batchBuffer.requiresCoherency,
-                 static_cast<OsContextLinux *>(osContext)->getDrmContextId(),
+                 drmContextId,
                  this->residency,
-                 this->execObjectsStorage.data());
+                 this->execObjectsStorage.data(),
+                 reuseExecObjects);
 
-        this->residency.clear();
+        this->submittedResidency.swap(this->residency);
+        this->submittedDrmContextId = drmContextId;
+        this->submittedReleasedBufferObjectsCount = this->getMemoryManager()->peekReleasedBufferObjectsCount();
+        this->clearResidency();
 
         if (this->gemCloseWorkerOperationMode == gemCloseWorkerActive) {
             bb->reference();
@@ -94,10 +102,8 @@ template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     if (bo) {
         if (bo->peekIsReusableAllocation()) {
-            for (auto bufferObject : this->residency) {
-                if (bufferObject == bo) {
-                    return;
-                }
+            if (!bo->markForResidency(osContext->getContextId(), residencyGeneration)) {
+                return;
             }
         }
 
@@ -105,6 +111,22 @@ void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
     }
 }
 
+template <typename GfxFamily>
+bool DrmCommandStreamReceiver<GfxFamily>::canReuseExecObjects(uint32_t drmContextId) {
+    // buffer object released since last exec may have been replaced by a new one at the same address
+    if (submittedDrmContextId != drmContextId ||
+        submittedReleasedBufferObjectsCount != getMemoryManager()->peekReleasedBufferObjectsCount()) {
+        return false;
+    }
+    return !residency.empty() && residency == submittedResidency;
+}
+
+template <typename GfxFamily>
+void DrmCommandStreamReceiver<GfxFamily>::clearResidency() {
+    residency.clear();
+    residencyGeneration++;
+}
+
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::processResidency(ResidencyContainer &inputAllocationsForResidency) {
     for (auto &alloc : inputAllocationsForResidency) {
@@ -131,7 +153,7 @@ void DrmCommandStreamReceiver<GfxFamily>::makeNonResident(GraphicsAllocation &gf
     // If makeNonResident is called before flush, vector will be cleared.
     if (gfxAllocation.isResident(this->osContext->getContextId())) {
         if (this->residency.size() != 0) {
-            this->residency.clear();
+            this->clearResidency();
         }
         if (gfxAllocation.fragmentsStorage.fragmentCount) {
             for (auto fragmentId = 0u; fragmentId < gfxAllocation.fragmentsStorage.fragmentCount; fragmentId++) {
@@ -8,6 +8,7 @@
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 
 #include "runtime/helpers/aligned_memory.h"
+#include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/os_interface/linux/drm_buffer_object.h"
 #include "runtime/os_interface/linux/drm_command_stream.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
@@ -15,12 +16,15 @@
 
 #include <atomic>
 #include <iostream>
-#include <queue>
 #include <stdio.h>
 
 namespace OCLRT {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
+    if (DebugManager.flags.OverrideGemCloseWorkerQueueLimit.get() != -1) {
+        queueLimit = static_cast<uint32_t>(DebugManager.flags.OverrideGemCloseWorkerQueueLimit.get());
+    }
+    queue.reserve(64);
     thread = Thread::create(worker, reinterpret_cast<void *>(this));
 }
 
@@ -42,15 +46,30 @@ DrmGemCloseWorker::~DrmGemCloseWorker() {
 
 void DrmGemCloseWorker::push(BufferObject *bo) {
     std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    if (queueLimit != 0 && workCount.load() >= queueLimit && active) {
+        backPressureWaits++;
+        backlogCondition.wait(lock, [this] { return workCount.load() < queueLimit || !active; });
+    }
     workCount++;
-    queue.push(bo);
+    bool wakeUpWorker = queue.empty();
+    queue.push_back({bo, std::chrono::steady_clock::now()});
+
+    auto queueDepth = workCount.load();
+    if (queueDepth > maxQueueDepth.load()) {
+        maxQueueDepth.store(queueDepth);
+    }
     lock.unlock();
-    condition.notify_one();
+
+    // worker sleeps only on empty queue
+    if (wakeUpWorker) {
+        condition.notify_one();
+    }
 }
 
 void DrmGemCloseWorker::close(bool blocking) {
     active = false;
     condition.notify_all();
+    backlogCondition.notify_all();
     if (blocking) {
         closeThread();
     }
@@ -60,47 +79,74 @@ bool DrmGemCloseWorker::isEmpty() {
     return workCount.load() == 0;
 }
 
+GemCloseWorkerStatistics DrmGemCloseWorker::getStatistics() const {
+    GemCloseWorkerStatistics statistics;
+    statistics.queueDepth = workCount.load();
+    statistics.maxQueueDepth = maxQueueDepth.load();
+    statistics.closedBufferObjects = closedBufferObjects.load();
+    statistics.batches = batches.load();
+    statistics.backPressureWaits = backPressureWaits.load();
+    statistics.totalLatencyNs = totalLatencyNs.load();
+    statistics.maxLatencyNs = maxLatencyNs.load();
+    return statistics;
+}
+
 inline void DrmGemCloseWorker::close(BufferObject *bo) {
     bo->wait(-1);
     memoryManager.unreference(bo);
     workCount--;
 }
 
+void DrmGemCloseWorker::closeBatch(std::vector<WorkItem> &batch) {
+    if (batch.empty()) {
+        return;
+    }
+
+    for (auto &workItem : batch) {
+        close(workItem.bo);
+
+        auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - workItem.pushTime).count();
+        totalLatencyNs += static_cast<uint64_t>(latency);
+        if (static_cast<uint64_t>(latency) > maxLatencyNs.load()) {
+            maxLatencyNs.store(static_cast<uint64_t>(latency));
+        }
+    }
+    closedBufferObjects += batch.size();
+    batches++;
+    batch.clear();
+
+    // pusher checks the backlog under the lock, taking it here guarantees the wake up is not lost
+    {
+        std::lock_guard<std::mutex> lock(closeWorkerMutex);
+    }
+    backlogCondition.notify_all();
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
-    BufferObject *workItem = nullptr;
-    std::queue<BufferObject *> localQueue;
+    std::vector<WorkItem> localQueue;
+    localQueue.reserve(64);
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
     while (self->active) {
         lock.lock();
-        workItem = nullptr;
 
         while (self->queue.empty() && self->active) {
             self->condition.wait(lock);
         }
 
-        if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
-        }
+        localQueue.swap(self->queue);
 
         lock.unlock();
-        while (!localQueue.empty()) {
-            workItem = localQueue.front();
-            localQueue.pop();
-            self->close(workItem);
-        }
+        self->closeBatch(localQueue);
     }
 
     lock.lock();
-    while (!self->queue.empty()) {
-        workItem = self->queue.front();
-        self->queue.pop();
-        self->close(workItem);
-    }
-
+    localQueue.swap(self->queue);
     lock.unlock();
+    self->closeBatch(localQueue);
+
     self->workerDone.store(true);
     return nullptr;
 }
@@ -7,12 +7,12 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <mutex>
-#include <queue>
-#include <set>
+#include <vector>
 
 namespace OCLRT {
 class DrmMemoryManager;
@@ -24,34 +24,64 @@ enum gemCloseWorkerMode {
     gemCloseWorkerActive
 };
 
+struct GemCloseWorkerStatistics {
+    uint32_t queueDepth = 0u;
+    uint32_t maxQueueDepth = 0u;
+    uint64_t closedBufferObjects = 0u;
+    uint64_t batches = 0u;
+    uint64_t backPressureWaits = 0u;
+    uint64_t totalLatencyNs = 0u;
+    uint64_t maxLatencyNs = 0u;
+};
+
 class DrmGemCloseWorker {
   public:
+    static const uint32_t defaultQueueLimit = 4096u;
+
     DrmGemCloseWorker(DrmMemoryManager &memoryManager);
     ~DrmGemCloseWorker();
 
     DrmGemCloseWorker(const DrmGemCloseWorker &) = delete;
     DrmGemCloseWorker &operator=(const DrmGemCloseWorker &) = delete;
 
+    // blocks while queueLimit buffer objects are already waiting to be closed
     void push(BufferObject *allocation);
     void close(bool blocking);
 
     bool isEmpty();
+    uint32_t getQueueLimit() const { return queueLimit; }
+    GemCloseWorkerStatistics getStatistics() const;
 
   protected:
+    struct WorkItem {
+        BufferObject *bo;
+        std::chrono::steady_clock::time_point pushTime;
+    };
+
     void close(BufferObject *workItem);
+    void closeBatch(std::vector<WorkItem> &batch);
     void closeThread();
     static void *worker(void *arg);
     bool active = true;
 
     std::unique_ptr<Thread> thread;
 
-    std::queue<BufferObject *> queue;
+    std::vector<WorkItem> queue;
     std::atomic<uint32_t> workCount{0};
+    uint32_t queueLimit = defaultQueueLimit;
 
     DrmMemoryManager &memoryManager;
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
+    std::condition_variable backlogCondition;
     std::atomic<bool> workerDone{false};
+
+    std::atomic<uint32_t> maxQueueDepth{0u};
+    std::atomic<uint64_t> closedBufferObjects{0u};
+    std::atomic<uint64_t> batches{0u};
+    std::atomic<uint64_t> backPressureWaits{0u};
+    std::atomic<uint64_t> totalLatencyNs{0u};
+    std::atomic<uint64_t> maxLatencyNs{0u};
 };
 } // namespace OCLRT
@@ -146,6 +146,7 @@ uint32_t DrmMemoryManager::unreference(OCLRT::BufferObject *bo, bool synchronous
             lock.unlock();
         }
 
+        releasedBufferObjectsCount++;
         delete bo;
         if (address) {
             if (unmapSize) {
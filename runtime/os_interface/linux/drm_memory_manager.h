@@ -55,6 +55,7 @@ class DrmMemoryManager : public MemoryManager {
     }
 
     DrmGemCloseWorker *peekGemCloseWorker() const { return this->gemCloseWorker.get(); }
+    uint64_t peekReleasedBufferObjectsCount() const { return releasedBufferObjectsCount.load(); }
     void *reserveCpuAddressRange(size_t size) override;
     void releaseReservedCpuAddressRange(void *reserved, size_t size) override;
 
@@ -94,6 +95,7 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
+    std::atomic<uint64_t> releasedBufferObjectsCount{0u};
     std::unique_ptr<Allocator32bit> internal32bitAllocator;
     std::unique_ptr<AllocatorLimitedRange> limitedGpuAddressRangeAllocator;
 };
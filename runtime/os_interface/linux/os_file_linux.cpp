@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/os_file.h"
+
+#include <cstdio>
+
+namespace OCLRT {
+bool replaceFile(const std::string &sourcePath, const std::string &destinationPath) {
+    return std::rename(sourcePath.c_str(), destinationPath.c_str()) == 0;
+}
+} // namespace OCLRT
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/os_file_lock_linux.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+namespace OCLRT {
+FileLockLinux::FileLockLinux(int fd) : fd(fd) {
+}
+
+FileLockLinux::~FileLockLinux() {
+    flock(fd, LOCK_UN);
+    close(fd);
+}
+
+std::unique_ptr<FileLock> FileLock::tryLock(const std::string &filePath) {
+    int fd = ::open(filePath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    if (fd < 0) {
+        return nullptr;
+    }
+    // flock locks the open file description, so separate opens contend also within one process
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    return std::unique_ptr<FileLock>(new FileLockLinux(fd));
+}
+} // namespace OCLRT
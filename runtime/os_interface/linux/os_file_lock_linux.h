@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/os_interface/os_file_lock.h"
+
+namespace OCLRT {
+class FileLockLinux : public FileLock {
+  public:
+    FileLockLinux(int fd);
+    ~FileLockLinux() override;
+
+  protected:
+    int fd;
+};
+} // namespace OCLRT
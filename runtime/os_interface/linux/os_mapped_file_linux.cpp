@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/linux/os_mapped_file_linux.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace OCLRT {
+MappedFileLinux::MappedFileLinux(void *mapping, size_t size) : mapping(mapping) {
+    this->data = static_cast<const char *>(mapping);
+    this->size = size;
+}
+
+MappedFileLinux::~MappedFileLinux() {
+    munmap(mapping, size);
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &filePath) {
+    int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    void *mapping = MAP_FAILED;
+    size_t fileSize = 0;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        fileSize = static_cast<size_t>(fileStat.st_size);
+        mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // mapping keeps its own reference to the file
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFileLinux(mapping, fileSize));
+}
+} // namespace OCLRT
@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/os_interface/os_mapped_file.h"
+
+namespace OCLRT {
+class MappedFileLinux : public MappedFile {
+  public:
+    MappedFileLinux(void *mapping, size_t size);
+    ~MappedFileLinux() override;
+
+  protected:
+    void *mapping;
+};
+} // namespace OCLRT
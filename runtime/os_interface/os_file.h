@@ -0,0 +1,14 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <string>
+
+namespace OCLRT {
+// moves source over destination in a single step, readers of destination see either its previous or new content
+bool replaceFile(const std::string &sourcePath, const std::string &destinationPath);
+} // namespace OCLRT
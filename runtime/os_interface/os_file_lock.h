@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <memory>
+#include <string>
+
+namespace OCLRT {
+
+// Exclusive lock of a file, shared by all processes of the system.
+// Released when the object is destroyed or by the OS when its owner terminates.
+class FileLock {
+  public:
+    // creates the file if missing, returns nullptr without waiting when the lock is already held
+    static std::unique_ptr<FileLock> tryLock(const std::string &filePath);
+    virtual ~FileLock() = default;
+};
+} // namespace OCLRT
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace OCLRT {
+
+class MappedFile {
+  public:
+    // maps whole file read-only, returns nullptr for missing or empty files
+    static std::unique_ptr<MappedFile> open(const std::string &filePath);
+    virtual ~MappedFile() = default;
+
+    const char *getData() const { return data; }
+    size_t getSize() const { return size; }
+
+  protected:
+    const char *data = nullptr;
+    size_t size = 0;
+};
+} // namespace OCLRT
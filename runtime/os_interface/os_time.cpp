@@ -11,6 +11,14 @@
 
 namespace OCLRT {
 
+bool OSTime::sampleCpuGpuTime(TimeStampData *pGpuCpuTime) {
+    if (!getCpuGpuTime(pGpuCpuTime)) {
+        return false;
+    }
+    cpuGpuTimeCalibration.addSample(*pGpuCpuTime);
+    return true;
+}
+
 double OSTime::getDeviceTimerResolution(HardwareInfo const &hwInfo) {
     return hwInfo.capabilityTable.defaultProfilingTimerResolution;
 };
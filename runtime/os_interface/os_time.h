@@ -21,6 +21,8 @@
  */
 
 #pragma once
+#include "runtime/os_interface/cpu_gpu_time_calibration.h"
+
 #include <memory>
 
 #define NSEC_PER_SEC (1000000000ULL)
@@ -49,10 +51,14 @@ class OSTime {
         return osInterface;
     }
 
+    bool sampleCpuGpuTime(TimeStampData *pGpuCpuTime);
+    CpuGpuTimeCalibration &getCpuGpuTimeCalibration() { return cpuGpuTimeCalibration; }
+
     static double getDeviceTimerResolution(HardwareInfo const &hwInfo);
 
   protected:
     OSTime() {}
     OSInterface *osInterface = nullptr;
+    CpuGpuTimeCalibration cpuGpuTimeCalibration;
 };
 } // namespace OCLRT
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/windows/os_file_lock_win.h"
+
+namespace OCLRT {
+FileLockWin::FileLockWin(HANDLE fileHandle) : fileHandle(fileHandle) {
+}
+
+FileLockWin::~FileLockWin() {
+    OVERLAPPED overlapped = {};
+    UnlockFileEx(fileHandle, 0, 1, 0, &overlapped);
+    CloseHandle(fileHandle);
+}
+
+std::unique_ptr<FileLock> FileLock::tryLock(const std::string &filePath) {
+    HANDLE fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    OVERLAPPED overlapped = {};
+    if (!LockFileEx(fileHandle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &overlapped)) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+    return std::unique_ptr<FileLock>(new FileLockWin(fileHandle));
+}
+} // namespace OCLRT
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/os_interface/os_file_lock.h"
+#include "runtime/os_interface/windows/windows_wrapper.h"
+
+namespace OCLRT {
+class FileLockWin : public FileLock {
+  public:
+    FileLockWin(HANDLE fileHandle);
+    ~FileLockWin() override;
+
+  protected:
+    HANDLE fileHandle;
+};
+} // namespace OCLRT
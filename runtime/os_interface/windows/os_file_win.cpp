@@ -0,0 +1,16 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/os_file.h"
+#include "runtime/os_interface/windows/windows_wrapper.h"
+
+namespace OCLRT {
+bool replaceFile(const std::string &sourcePath, const std::string &destinationPath) {
+    // rename of the C runtime fails when destination exists
+    return MoveFileExA(sourcePath.c_str(), destinationPath.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+}
+} // namespace OCLRT
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/windows/os_mapped_file_win.h"
+
+namespace OCLRT {
+MappedFileWin::MappedFileWin(HANDLE mappingHandle, const void *view, size_t size) : mappingHandle(mappingHandle) {
+    this->data = static_cast<const char *>(view);
+    this->size = size;
+}
+
+MappedFileWin::~MappedFileWin() {
+    UnmapViewOfFile(data);
+    CloseHandle(mappingHandle);
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &filePath) {
+    HANDLE fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    HANDLE mappingHandle = nullptr;
+    if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0) {
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    // mapping keeps its own reference to the file
+    CloseHandle(fileHandle);
+
+    if (mappingHandle == nullptr) {
+        return nullptr;
+    }
+    auto view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mappingHandle);
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFileWin(mappingHandle, view, static_cast<size_t>(fileSize.QuadPart)));
+}
+} // namespace OCLRT
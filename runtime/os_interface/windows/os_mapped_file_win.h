@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/os_interface/os_mapped_file.h"
+#include "runtime/os_interface/windows/windows_wrapper.h"
+
+namespace OCLRT {
+class MappedFileWin : public MappedFile {
+  public:
+    MappedFileWin(HANDLE mappingHandle, const void *view, size_t size);
+    ~MappedFileWin() override;
+
+  protected:
+    HANDLE mappingHandle;
+};
+} // namespace OCLRT
@@ -14,6 +14,7 @@
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/mem_obj/image.h"
 #include "runtime/memory_manager/memory_manager.h"
+#include "runtime/program/print_formatter.h"
 #include "runtime/sampler/sampler.h"
 
 #include "hw_cmds.h"
@@ -382,7 +383,8 @@ void KernelInfo::storePatchToken(const SPatchString *pStringArg) {
         printfStringInfo.pStringData = new char[printfStringInfo.SizeInBytes];
         if (printfStringInfo.pStringData != nullptr) {
             memcpy_s(printfStringInfo.pStringData, printfStringInfo.SizeInBytes, (cl_char *)pStringArg + sizeof(SPatchString), printfStringInfo.SizeInBytes);
-            patchInfo.stringDataMap.insert(std::pair<uint32_t, PrintfStringInfo>(stringIndex, printfStringInfo));
+            PrintFormatter::tokenizeFormatString(printfStringInfo.pStringData, printfStringInfo.formatTokens);
+            patchInfo.stringDataMap.insert(std::pair<uint32_t, PrintfStringInfo>(stringIndex, std::move(printfStringInfo)));
         }
     }
 }
@@ -409,6 +411,11 @@ const char *KernelInfo::queryPrintfString(uint32_t index) const {
     return printfInfo == patchInfo.stringDataMap.end() ? nullptr : printfInfo->second.pStringData;
 }
 
+const PrintfStringInfo *KernelInfo::queryPrintfStringInfo(uint32_t index) const {
+    auto printfInfo = patchInfo.stringDataMap.find(index);
+    return printfInfo == patchInfo.stringDataMap.end() ? nullptr : &printfInfo->second;
+}
+
 cl_int KernelInfo::resolveKernelInfo() {
     cl_int retVal = CL_SUCCESS;
     std::unordered_map<std::string, uint32_t>::iterator iterUint;
@@ -164,6 +164,7 @@ struct KernelInfo {
     void storeKernelArgPatchInfo(uint32_t argNum, uint32_t dataSize, uint32_t crossthreadOffset, uint32_t sourceOffset, uint32_t offsetSSH);
 
     const char *queryPrintfString(uint32_t index) const;
+    const PrintfStringInfo *queryPrintfStringInfo(uint32_t index) const;
 
     size_t getSamplerStateArrayCount() const;
     size_t getSamplerStateArraySize(const HardwareInfo &hwInfo) const;
@@ -10,6 +10,7 @@
 #include "patch_list.h"
 
 #include <map>
+#include <string>
 #include <vector>
 
 namespace OCLRT {
@@ -44,9 +45,20 @@ using iOpenCL::SPatchString;
 using iOpenCL::SPatchThreadPayload;
 using iOpenCL::SProgramBinaryHeader;
 
+struct PrintfFormatToken {
+    enum class Type {
+        Literal,
+        Conversion,
+        StringConversion
+    };
+    Type type;
+    std::string text;
+};
+
 typedef struct TagPrintfStringInfo {
     size_t SizeInBytes;
     char *pStringData;
+    std::vector<PrintfFormatToken> formatTokens; // pStringData parsed once when the kernel binary is processed
 } PrintfStringInfo, *PPrintfStringInfo;
 
 struct PatchInfo {
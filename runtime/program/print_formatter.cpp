@@ -31,48 +31,86 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
     read(&bufferSize);
 
     uint32_t stringIndex = 0;
+    std::vector<PrintfFormatToken> notParsedFormatTokens;
 
     while (offset + 4 <= bufferSize) {
         read(&stringIndex);
-        const char *formatString = kernel.getKernelInfo().queryPrintfString(stringIndex);
-        if (formatString != nullptr) {
-            printString(formatString, print);
+        auto stringInfo = kernel.getKernelInfo().queryPrintfStringInfo(stringIndex);
+        if (stringInfo == nullptr || stringInfo->pStringData == nullptr) {
+            continue;
+        }
+        if (stringInfo->formatTokens.empty()) {
+            tokenizeFormatString(stringInfo->pStringData, notParsedFormatTokens);
+            printString(notParsedFormatTokens, print);
+        } else {
+            printString(stringInfo->formatTokens, print);
         }
     }
 }
 
-void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
+void PrintFormatter::tokenizeFormatString(const char *formatString, std::vector<PrintfFormatToken> &tokens) {
+    tokens.clear();
     size_t length = strnlen_s(formatString, maxPrintfOutputLength);
-    char output[maxPrintfOutputLength];
+    std::string literal;
 
-    size_t cursor = 0;
-    for (size_t i = 0; i <= length; i++) {
-        if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
-        else if (formatString[i] == '%') {
-            size_t end = i;
-            if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+    for (size_t i = 0; i < length; i++) {
+        if (formatString[i] == '\\') {
+            if (++i == length) {
+                break;
+            }
+            literal += escapeChar(formatString[i]);
+        } else if (formatString[i] == '%') {
+            if (i + 1 < length && formatString[i + 1] == '%') {
+                literal += '%';
+                i++;
                 continue;
             }
 
+            size_t end = i;
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
-            char dataFormat[maxPrintfOutputLength];
 
-            memcpy_s(dataFormat, maxPrintfOutputLength, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
-
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output + cursor, maxPrintfOutputLength - cursor, dataFormat);
-            else
-                cursor += printToken(output + cursor, maxPrintfOutputLength - cursor, dataFormat);
+            if (!literal.empty()) {
+                tokens.push_back({PrintfFormatToken::Type::Literal, std::move(literal)});
+                literal.clear();
+            }
+            auto type = formatString[end - 1] == 's' ? PrintfFormatToken::Type::StringConversion : PrintfFormatToken::Type::Conversion;
+            tokens.push_back({type, std::string(formatString + i, end - i)});
 
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            literal += formatString[i];
+        }
+    }
+
+    if (!literal.empty()) {
+        tokens.push_back({PrintfFormatToken::Type::Literal, std::move(literal)});
+    }
+}
+
+void PrintFormatter::printString(const std::vector<PrintfFormatToken> &formatTokens, const std::function<void(char *)> &print) {
+    char output[maxPrintfOutputLength];
+
+    size_t cursor = 0;
+    for (auto &token : formatTokens) {
+        switch (token.type) {
+        case PrintfFormatToken::Type::Literal: {
+            auto literalLength = std::min(token.text.size(), maxPrintfOutputLength - 1 - cursor);
+            memcpy_s(output + cursor, maxPrintfOutputLength - cursor, token.text.c_str(), literalLength);
+            cursor += literalLength;
+            break;
+        }
+        case PrintfFormatToken::Type::StringConversion:
+            cursor += printStringToken(output + cursor, maxPrintfOutputLength - cursor, token.text.c_str());
+            break;
+        default:
+            cursor += printToken(output + cursor, maxPrintfOutputLength - cursor, token.text.c_str());
+            break;
         }
+        // printed values are truncated to the output size, but their full length is returned
+        cursor = std::min(cursor, maxPrintfOutputLength - 1);
     }
+    output[cursor] = '\0';
 
     print(output);
 }
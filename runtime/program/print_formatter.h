@@ -15,6 +15,7 @@
 #include <cctype>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count);
 
@@ -45,14 +46,16 @@ class PrintFormatter {
 
     static const size_t maxPrintfOutputLength = 1024;
 
+    static void tokenizeFormatString(const char *formatString, std::vector<PrintfFormatToken> &tokens);
+
   protected:
-    void printString(const char *formatString, const std::function<void(char *)> &print);
+    void printString(const std::vector<PrintfFormatToken> &formatTokens, const std::function<void(char *)> &print);
     size_t printToken(char *output, size_t size, const char *formatString);
     size_t printStringToken(char *output, size_t size, const char *formatString);
     size_t printPointerToken(char *output, size_t size, const char *formatString);
 
-    char escapeChar(char escape);
-    bool isConversionSpecifier(char c);
+    static char escapeChar(char escape);
+    static bool isConversionSpecifier(char c);
     void stripVectorFormat(const char *format, char *stripped);
     void stripVectorTypeConversion(char *format);
 
@@ -14,13 +14,14 @@
 #include "runtime/mem_obj/buffer.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/program/print_formatter.h"
+#include "runtime/program/printf_surface_pool.h"
 
 namespace OCLRT {
 
 PrintfHandler::PrintfHandler(Device &deviceArg) : device(deviceArg) {}
 
 PrintfHandler::~PrintfHandler() {
-    device.getMemoryManager()->freeGraphicsMemory(printfSurface);
+    device.getPrintfSurfacePool()->releaseSurface(printfSurface);
 }
 
 PrintfHandler *PrintfHandler::create(const MultiDispatchInfo &multiDispatchInfo, Device &device) {
@@ -37,7 +38,8 @@ void PrintfHandler::prepareDispatch(const MultiDispatchInfo &multiDispatchInfo)
         return;
     }
     kernel = multiDispatchInfo.peekMainKernel();
-    printfSurface = device.getMemoryManager()->allocateGraphicsMemoryWithProperties({printfSurfaceSize, GraphicsAllocation::AllocationType::PRINTF_SURFACE});
+    printfSurface = device.getPrintfSurfacePool()->obtainSurface(printfSurfaceSize);
+    // a recycled surface only needs its header reset, the kernel overwrites the data that follows
     *reinterpret_cast<uint32_t *>(printfSurface->getUnderlyingBuffer()) = printfSurfaceInitialDataSize;
 
     auto printfPatchAddress = ptrOffset(reinterpret_cast<uintptr_t *>(kernel->getCrossThreadData()),
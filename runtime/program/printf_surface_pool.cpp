@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/program/printf_surface_pool.h"
+
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/memory_manager/memory_manager.h"
+#include "runtime/os_interface/os_context.h"
+
+namespace OCLRT {
+
+constexpr size_t PrintfSurfacePool::maxPooledSurfaces;
+
+PrintfSurfacePool::PrintfSurfacePool(ExecutionEnvironment &executionEnvironment) : executionEnvironment(executionEnvironment) {}
+
+PrintfSurfacePool::~PrintfSurfacePool() {
+    for (auto surface : surfaces) {
+        getMemoryManager().checkGpuUsageAndDestroyGraphicsAllocations(surface);
+    }
+}
+
+GraphicsAllocation *PrintfSurfacePool::obtainSurface(size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = surfaces.begin(); it != surfaces.end(); ++it) {
+            auto surface = *it;
+            if (surface->getUnderlyingBufferSize() == size && isSurfaceCompleted(*surface)) {
+                surfaces.erase(it);
+                return surface;
+            }
+        }
+    }
+    return getMemoryManager().allocateGraphicsMemoryWithProperties({size, GraphicsAllocation::AllocationType::PRINTF_SURFACE});
+}
+
+void PrintfSurfacePool::releaseSurface(GraphicsAllocation *surface) {
+    if (surface == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (surfaces.size() < maxPooledSurfaces) {
+            surfaces.push_back(surface);
+            return;
+        }
+    }
+    getMemoryManager().checkGpuUsageAndDestroyGraphicsAllocations(surface);
+}
+
+MemoryManager &PrintfSurfacePool::getMemoryManager() {
+    return *executionEnvironment.memoryManager;
+}
+
+size_t PrintfSurfacePool::getPooledSurfacesCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return surfaces.size();
+}
+
+bool PrintfSurfacePool::isSurfaceCompleted(GraphicsAllocation &surface) {
+    if (!surface.isUsed()) {
+        return true;
+    }
+    for (auto &engine : getMemoryManager().getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        if (surface.isUsedByOsContext(osContextId) &&
+            surface.getTaskCount(osContextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace OCLRT
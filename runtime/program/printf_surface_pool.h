@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace OCLRT {
+class ExecutionEnvironment;
+class GraphicsAllocation;
+class MemoryManager;
+
+// Printf surfaces released by enqueues are kept per device and handed out again
+// once no engine uses them anymore, instead of being allocated on every enqueue.
+class PrintfSurfacePool {
+  public:
+    PrintfSurfacePool(ExecutionEnvironment &executionEnvironment);
+    ~PrintfSurfacePool();
+
+    GraphicsAllocation *obtainSurface(size_t size);
+    void releaseSurface(GraphicsAllocation *surface);
+
+    size_t getPooledSurfacesCount();
+
+    static constexpr size_t maxPooledSurfaces = 16u;
+
+  protected:
+    MemoryManager &getMemoryManager();
+    bool isSurfaceCompleted(GraphicsAllocation &surface);
+
+    ExecutionEnvironment &executionEnvironment;
+    std::mutex mutex;
+    std::vector<GraphicsAllocation *> surfaces;
+};
+} // namespace OCLRT
@@ -19,6 +19,9 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace iOpenCL;
 
@@ -31,12 +34,29 @@ const KernelInfo *Program::getKernelInfo(
         return nullptr;
     }
 
+    auto indexed = kernelInfoIndex.find(kernelName);
+    if (indexed != kernelInfoIndex.end() && indexed->second < kernelInfoArray.size()) {
+        auto kernelInfo = kernelInfoArray[indexed->second];
+        if (kernelInfo->name == kernelName) {
+            return kernelInfo;
+        }
+    }
+
     auto it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
                            [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->name.c_str(), kernelName)); });
 
     return (it != kernelInfoArray.end()) ? *it : nullptr;
 }
 
+void Program::buildKernelInfoIndex() {
+    kernelInfoIndex.clear();
+    kernelInfoIndex.reserve(kernelInfoArray.size());
+    for (size_t i = 0; i < kernelInfoArray.size(); i++) {
+        // first kernel with a given name wins, same as the linear lookup
+        kernelInfoIndex.emplace(kernelInfoArray[i]->name, i);
+    }
+}
+
 size_t Program::getNumKernels() const {
     return kernelInfoArray.size();
 }
@@ -62,7 +82,31 @@ std::string Program::getKernelNamesString() const {
 size_t Program::processKernel(
     const void *pKernelBlob,
     cl_int &retVal) {
+    KernelInfo *pKernelInfo = nullptr;
+    auto sizeProcessed = parseKernel(pKernelBlob, pKernelInfo, retVal);
+    if (retVal == CL_SUCCESS) {
+        retVal = storeKernelInfo(pKernelInfo);
+    }
+    return sizeProcessed;
+}
+
+size_t Program::getKernelBlobSize(const void *pKernelBlob) {
+    auto pKernelHeader = reinterpret_cast<const SKernelBinaryHeaderCommon *>(pKernelBlob);
+    return sizeof(SKernelBinaryHeaderCommon) +
+           pKernelHeader->DynamicStateHeapSize +
+           pKernelHeader->GeneralStateHeapSize +
+           pKernelHeader->KernelHeapSize +
+           pKernelHeader->KernelNameSize +
+           pKernelHeader->PatchListSize +
+           pKernelHeader->SurfaceStateHeapSize;
+}
+
+size_t Program::parseKernel(
+    const void *pKernelBlob,
+    KernelInfo *&pKernelInfoOut,
+    cl_int &retVal) {
     size_t sizeProcessed = 0;
+    pKernelInfoOut = nullptr;
 
     do {
         auto pKernelInfo = new KernelInfo();
@@ -96,25 +140,21 @@ size_t Program::processKernel(
         pKernelInfo->heapInfo.pPatchList = pCurKernelPtr;
 
         retVal = parsePatchList(*pKernelInfo);
-        if (retVal != CL_SUCCESS) {
+        // for kernels with ISA the result is decided by ISA allocation in storeKernelInfo,
+        // the same as when the allocation was created at the end of patch list parsing
+        bool allocationOverridesStatus = pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize && this->pDevice;
+        if (retVal != CL_SUCCESS && !allocationOverridesStatus) {
             delete pKernelInfo;
             sizeProcessed = ptrDiff(pCurKernelPtr, pKernelBlob);
             break;
         }
 
-        auto pKernelHeader = pKernelInfo->heapInfo.pKernelHeader;
         auto pKernel = ptrOffset(pKernelBlob, sizeof(SKernelBinaryHeaderCommon));
 
         if (genBinary)
             pKernelInfo->gpuPointerSize = reinterpret_cast<const SProgramBinaryHeader *>(genBinary)->GPUPointerSizeInBytes;
 
-        uint32_t kernelSize =
-            pKernelHeader->DynamicStateHeapSize +
-            pKernelHeader->GeneralStateHeapSize +
-            pKernelHeader->KernelHeapSize +
-            pKernelHeader->KernelNameSize +
-            pKernelHeader->PatchListSize +
-            pKernelHeader->SurfaceStateHeapSize;
+        uint32_t kernelSize = static_cast<uint32_t>(getKernelBlobSize(pKernelBlob) - sizeof(SKernelBinaryHeaderCommon));
 
         pKernelInfo->heapInfo.blobSize = kernelSize + sizeof(SKernelBinaryHeaderCommon);
 
@@ -127,18 +167,86 @@ size_t Program::processKernel(
 
         retVal = CL_SUCCESS;
         sizeProcessed = sizeof(SKernelBinaryHeaderCommon) + kernelSize;
-        kernelInfoArray.push_back(pKernelInfo);
-        if (pKernelInfo->hasDeviceEnqueue()) {
-            parentKernelInfoArray.push_back(pKernelInfo);
-        }
-        if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
-            subgroupKernelInfoArray.push_back(pKernelInfo);
-        }
+        pKernelInfoOut = pKernelInfo;
     } while (false);
 
     return sizeProcessed;
 }
 
+cl_int Program::storeKernelInfo(KernelInfo *pKernelInfo) {
+    if (pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
+        if (!pKernelInfo->createKernelAllocation(this->pDevice->getMemoryManager())) {
+            delete pKernelInfo;
+            return CL_OUT_OF_HOST_MEMORY;
+        }
+    }
+
+    DEBUG_BREAK_IF(pKernelInfo->heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
+
+    kernelInfoArray.push_back(pKernelInfo);
+    if (pKernelInfo->hasDeviceEnqueue()) {
+        parentKernelInfoArray.push_back(pKernelInfo);
+    }
+    if (pKernelInfo->requiresSubgroupIndependentForwardProgress()) {
+        subgroupKernelInfoArray.push_back(pKernelInfo);
+    }
+    return CL_SUCCESS;
+}
+
+cl_int Program::processKernelsInParallel(const void *pKernelBlobs, size_t kernelBlobsSize, uint32_t numKernels, uint32_t numThreads) {
+    // kernel headers give all sizes, so kernel boundaries are known before parsing
+    // and a kernel not fitting in the gen binary fails the binary before any kernel is parsed
+    std::vector<const void *> kernelBlobs(numKernels);
+    auto pKernelBlobsEnd = ptrOffset(pKernelBlobs, kernelBlobsSize);
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto remainingSize = ptrDiff(pKernelBlobsEnd, pKernelBlobs);
+        if (remainingSize < sizeof(SKernelBinaryHeaderCommon) || remainingSize < getKernelBlobSize(pKernelBlobs)) {
+            return CL_INVALID_BINARY;
+        }
+        kernelBlobs[i] = pKernelBlobs;
+        pKernelBlobs = ptrOffset(pKernelBlobs, getKernelBlobSize(pKernelBlobs));
+    }
+
+    std::vector<KernelInfo *> parsedKernelInfos(numKernels, nullptr);
+    std::vector<cl_int> parseResults(numKernels, CL_SUCCESS);
+    std::atomic<uint32_t> nextKernel{0};
+    auto parseKernels = [&]() {
+        for (auto i = nextKernel++; i < numKernels; i = nextKernel++) {
+            parseKernel(kernelBlobs[i], parsedKernelInfos[i], parseResults[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < numThreads; i++) {
+        threads.emplace_back(parseKernels);
+    }
+    parseKernels();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // allocations and program state are updated in kernel order, as in sequential processing
+    cl_int retVal = CL_SUCCESS;
+    for (uint32_t i = 0; i < numKernels; i++) {
+        if (retVal == CL_SUCCESS) {
+            retVal = parseResults[i];
+            if (retVal == CL_SUCCESS) {
+                retVal = storeKernelInfo(parsedKernelInfos[i]);
+            }
+        } else {
+            delete parsedKernelInfos[i];
+        }
+    }
+    return retVal;
+}
+
+uint32_t Program::getKernelParsingThreadsCount(uint32_t numKernels) {
+    // sequential unless threads are requested, spawning threads for each program does not pay off in general
+    auto numThreads = static_cast<uint32_t>(std::max(1, DebugManager.flags.ParallelKernelParsingThreads.get()));
+    // spawning threads does not pay off for small binaries
+    return std::min(numThreads, std::max(1u, numKernels / minKernelsPerParsingThread));
+}
+
 cl_int Program::parsePatchList(KernelInfo &kernelInfo) {
     cl_int retVal = CL_SUCCESS;
 
@@ -826,12 +934,6 @@ cl_int Program::parsePatchList(KernelInfo &kernelInfo) {
         }
     }
 
-    if (kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && this->pDevice) {
-        retVal = kernelInfo.createKernelAllocation(this->pDevice->getMemoryManager()) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
-    }
-
-    DEBUG_BREAK_IF(kernelInfo.heapInfo.pKernelHeader->KernelHeapSize && !this->pDevice);
-
     return retVal;
 }
 
@@ -986,6 +1088,13 @@ cl_int Program::processGenBinary() {
         pCurBinaryPtr = ptrOffset(pCurBinaryPtr, pGenBinaryHeader->PatchListSize);
 
         auto numKernels = pGenBinaryHeader->NumberOfKernels;
+        auto numThreads = getKernelParsingThreadsCount(numKernels);
+        if (retVal == CL_SUCCESS && numThreads > 1) {
+            auto kernelBlobsSize = genBinarySize - std::min(genBinarySize, ptrDiff(pCurBinaryPtr, genBinary));
+            retVal = processKernelsInParallel(pCurBinaryPtr, kernelBlobsSize, numKernels, numThreads);
+            break;
+        }
+
         for (uint32_t i = 0; i < numKernels && retVal == CL_SUCCESS; i++) {
 
             size_t bytesProcessed = processKernel(pCurBinaryPtr, retVal);
@@ -993,6 +1102,8 @@ cl_int Program::processGenBinary() {
         }
     } while (false);
 
+    buildKernelInfoIndex();
+
     return retVal;
 }
 
@@ -362,6 +362,7 @@ void Program::separateBlockKernels() {
         }
     }
     allKernelInfos.clear();
+    buildKernelInfoIndex();
 }
 
 void Program::allocateBlockPrivateSurfaces() {
@@ -409,6 +410,7 @@ void Program::cleanCurrentKernelInfo() {
         delete kernelInfo;
     }
     kernelInfoArray.clear();
+    kernelInfoIndex.clear();
 }
 
 void Program::updateNonUniformFlag() {
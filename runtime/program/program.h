@@ -21,6 +21,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #define OCLRT_ALIGN(a, b) ((((a) % (b)) != 0) ? ((a) - ((a) % (b)) + (b)) : (a))
@@ -254,6 +255,13 @@ class Program : public BaseObject<_cl_program> {
     cl_int parsePatchList(KernelInfo &pKernelInfo);
 
     size_t processKernel(const void *pKernelBlob, cl_int &retVal);
+    // parses kernel without touching program state, safe to call concurrently
+    size_t parseKernel(const void *pKernelBlob, KernelInfo *&pKernelInfo, cl_int &retVal);
+    cl_int storeKernelInfo(KernelInfo *pKernelInfo);
+    cl_int processKernelsInParallel(const void *pKernelBlobs, size_t kernelBlobsSize, uint32_t numKernels, uint32_t numThreads);
+    static size_t getKernelBlobSize(const void *pKernelBlob);
+    static uint32_t getKernelParsingThreadsCount(uint32_t numKernels);
+    static const uint32_t minKernelsPerParsingThread = 16;
 
     void storeBinary(char *&pDst, size_t &dstSize, const void *pSrc, const size_t srcSize);
 
@@ -263,6 +271,7 @@ class Program : public BaseObject<_cl_program> {
     std::string getKernelNamesString() const;
 
     void separateBlockKernels();
+    void buildKernelInfoIndex();
 
     void updateNonUniformFlag();
     void updateNonUniformFlag(const Program **inputProgram, size_t numInputPrograms);
@@ -291,6 +300,8 @@ class Program : public BaseObject<_cl_program> {
     size_t                    debugDataSize;
 
     std::vector<KernelInfo*>  kernelInfoArray;
+    // kernel name -> ordinal in kernelInfoArray, entries are verified on lookup
+    std::unordered_map<std::string, size_t> kernelInfoIndex;
     std::vector<KernelInfo*>  parentKernelInfoArray;
     std::vector<KernelInfo*>  subgroupKernelInfoArray;
     BlockKernelManager *      blockKernelManager;
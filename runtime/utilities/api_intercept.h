@@ -8,9 +8,11 @@
 #pragma once
 #include "runtime/os_interface/debug_settings_manager.h"
 #include "runtime/utilities/perf_profiler.h"
+#include "runtime/utilities/timeline_tracer.h"
 
-#define API_ENTER(retValPointer) \
-    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                            \
+    DebugSettingsApiEnterWrapper<DebugManager.debugLoggingAvailable()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    TimelineScope TimelineScopeForSingleApiCall(__FUNCTION__)
 #define SYSTEM_ENTER()
 #define SYSTEM_LEAVE(id)
 #define WAIT_ENTER()
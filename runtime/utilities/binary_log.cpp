@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/binary_log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+namespace OCLRT {
+
+constexpr size_t BinaryLogRecord::textSize;
+constexpr uint32_t BinaryLogFileHeader::currentVersion;
+constexpr size_t BinaryLogWriter::defaultRecordsPerThread;
+constexpr uint32_t BinaryLogWriter::flushIntervalMs;
+
+namespace {
+const char binaryLogMagic[8] = "NEOBLOG";
+
+std::atomic<uint64_t> writersCount{0};
+std::atomic<uint32_t> loggingThreadsCount{0};
+
+struct ThreadBufferCache {
+    uint64_t writerId = 0;
+    BinaryLogRingBuffer *buffer = nullptr;
+};
+thread_local ThreadBufferCache threadBufferCache;
+
+uint32_t getLoggingThreadId() {
+    thread_local uint32_t threadId = ++loggingThreadsCount;
+    return threadId;
+}
+} // namespace
+
+size_t BinaryLogRingBuffer::drain(std::vector<BinaryLogRecord> &output) {
+    auto first = tail.load(std::memory_order_relaxed);
+    auto last = head.load(std::memory_order_acquire);
+    for (auto position = first; position < last; position++) {
+        output.push_back(records[position % records.size()]);
+    }
+    tail.store(last, std::memory_order_release);
+    return static_cast<size_t>(last - first);
+}
+
+BinaryLogWriter::BinaryLogWriter(std::unique_ptr<std::ostream> out, size_t recordsPerThread)
+    : out(std::move(out)), recordsPerThread(std::max(recordsPerThread, static_cast<size_t>(1))), writerId(++writersCount) {
+    BinaryLogFileHeader header = {};
+    memcpy(header.magic, binaryLogMagic, sizeof(header.magic));
+    header.version = BinaryLogFileHeader::currentVersion;
+    header.recordSize = sizeof(BinaryLogRecord);
+    if (this->out) {
+        this->out->write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+    flushThread = std::thread([this] { flushThreadFunc(); });
+}
+
+BinaryLogWriter::~BinaryLogWriter() {
+    {
+        std::lock_guard<std::mutex> autolock(wakeMutex);
+        stopRequested = true;
+    }
+    wakeCondition.notify_one();
+    flushThread.join();
+    flush();
+}
+
+void BinaryLogWriter::logApiCall(const char *function, bool enter, int32_t errorCode) {
+    push(enter ? BinaryLogRecordType::ApiEnter : BinaryLogRecordType::ApiLeave, errorCode, function, strlen(function));
+}
+
+void BinaryLogWriter::logMessage(const std::string &message) {
+    push(BinaryLogRecordType::Message, 0, message.c_str(), message.size());
+}
+
+void BinaryLogWriter::push(BinaryLogRecordType type, int32_t value, const char *text, size_t textLength) {
+    auto &buffer = getThreadBuffer();
+    BinaryLogRecord record = {};
+    record.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    record.threadId = buffer.getThreadId();
+    record.type = type;
+    record.value = value;
+
+    // long messages continue in following records, api call names are truncated
+    do {
+        auto chunkLength = std::min(textLength, BinaryLogRecord::textSize);
+        record.textLength = static_cast<uint16_t>(chunkLength);
+        memcpy(record.text, text, chunkLength);
+        if (!buffer.push(record) || type != BinaryLogRecordType::Message) {
+            return;
+        }
+        text += chunkLength;
+        textLength -= chunkLength;
+        record.type = BinaryLogRecordType::MessageContinuation;
+    } while (textLength > 0);
+}
+
+BinaryLogRingBuffer &BinaryLogWriter::getThreadBuffer() {
+    if (threadBufferCache.writerId == writerId) {
+        return *threadBufferCache.buffer;
+    }
+
+    auto threadId = getLoggingThreadId();
+    std::lock_guard<std::mutex> autolock(buffersMutex);
+    auto buffer = std::find_if(threadBuffers.begin(), threadBuffers.end(), [=](const std::unique_ptr<BinaryLogRingBuffer> &threadBuffer) {
+        return threadBuffer->getThreadId() == threadId;
+    });
+    if (buffer == threadBuffers.end()) {
+        threadBuffers.push_back(std::unique_ptr<BinaryLogRingBuffer>(new BinaryLogRingBuffer(recordsPerThread, threadId)));
+        buffer = threadBuffers.end() - 1;
+    }
+    threadBufferCache.writerId = writerId;
+    threadBufferCache.buffer = buffer->get();
+    return **buffer;
+}
+
+size_t BinaryLogWriter::getThreadBuffersCount() const {
+    std::lock_guard<std::mutex> autolock(buffersMutex);
+    return threadBuffers.size();
+}
+
+void BinaryLogWriter::flush() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+    drainedRecords.clear();
+    {
+        std::lock_guard<std::mutex> autolock(buffersMutex);
+        for (auto &threadBuffer : threadBuffers) {
+            threadBuffer->drain(drainedRecords);
+            auto droppedCount = threadBuffer->takeDroppedCount();
+            if (droppedCount > 0) {
+                BinaryLogRecord record = {};
+                record.threadId = threadBuffer->getThreadId();
+                record.type = BinaryLogRecordType::Dropped;
+                record.value = static_cast<int32_t>(std::min(droppedCount, static_cast<uint64_t>(std::numeric_limits<int32_t>::max())));
+                drainedRecords.push_back(record);
+            }
+        }
+    }
+    if (out && !drainedRecords.empty()) {
+        out->write(reinterpret_cast<const char *>(drainedRecords.data()), drainedRecords.size() * sizeof(BinaryLogRecord));
+        out->flush();
+    }
+}
+
+void BinaryLogWriter::flushThreadFunc() {
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    while (!stopRequested) {
+        wakeCondition.wait_for(lock, std::chrono::milliseconds(flushIntervalMs), [this] { return stopRequested; });
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+bool BinaryLogDecoder::decode(std::istream &in, std::ostream &out) {
+    BinaryLogFileHeader header = {};
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || memcmp(header.magic, binaryLogMagic, sizeof(header.magic)) != 0 ||
+        header.version != BinaryLogFileHeader::currentVersion || header.recordSize != sizeof(BinaryLogRecord)) {
+        return false;
+    }
+
+    BinaryLogRecord record;
+    while (in.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+        std::string text(record.text, std::min(static_cast<size_t>(record.textLength), BinaryLogRecord::textSize));
+        switch (record.type) {
+        case BinaryLogRecordType::ApiEnter:
+            out << "ThreadID: " << record.threadId << " [" << record.timestampNs << "] Function Enter: " << text << "\n";
+            break;
+        case BinaryLogRecordType::ApiLeave:
+            out << "ThreadID: " << record.threadId << " [" << record.timestampNs << "] Function Leave (" << record.value << "): " << text << "\n";
+            break;
+        case BinaryLogRecordType::Message:
+            out << "ThreadID: " << record.threadId << " [" << record.timestampNs << "] " << text;
+            break;
+        case BinaryLogRecordType::MessageContinuation:
+            out << text;
+            break;
+        case BinaryLogRecordType::Dropped:
+            out << "ThreadID: " << record.threadId << " " << record.value << " records dropped\n";
+            break;
+        default:
+            return false;
+        }
+    }
+    return in.eof();
+}
+} // namespace OCLRT
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OCLRT {
+
+enum class BinaryLogRecordType : uint16_t {
+    ApiEnter = 0,
+    ApiLeave,
+    Message,
+    MessageContinuation,
+    Dropped
+};
+
+struct BinaryLogRecord {
+    static constexpr size_t textSize = 44;
+
+    uint64_t timestampNs;
+    uint32_t threadId;
+    BinaryLogRecordType type;
+    uint16_t textLength;
+    int32_t value;
+    char text[textSize];
+};
+static_assert(sizeof(BinaryLogRecord) == 64, "binary log record size is part of the file format");
+
+struct BinaryLogFileHeader {
+    static constexpr uint32_t currentVersion = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+};
+
+// Single producer, single consumer queue of records. When the consumer falls behind,
+// new records are dropped and counted rather than blocking the producing thread.
+class BinaryLogRingBuffer {
+  public:
+    BinaryLogRingBuffer(size_t capacity, uint32_t threadId) : records(capacity), threadId(threadId) {}
+
+    bool push(const BinaryLogRecord &record) {
+        auto position = head.load(std::memory_order_relaxed);
+        if (position - tail.load(std::memory_order_acquire) == records.size()) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        records[position % records.size()] = record;
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t drain(std::vector<BinaryLogRecord> &output);
+
+    uint64_t takeDroppedCount() { return dropped.exchange(0, std::memory_order_relaxed); }
+    uint32_t getThreadId() const { return threadId; }
+    size_t getCapacity() const { return records.size(); }
+
+  protected:
+    std::vector<BinaryLogRecord> records;
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+    const uint32_t threadId;
+};
+
+class BinaryLogWriter {
+  public:
+    static constexpr size_t defaultRecordsPerThread = 4096;
+    static constexpr uint32_t flushIntervalMs = 10;
+
+    BinaryLogWriter(std::unique_ptr<std::ostream> out, size_t recordsPerThread = defaultRecordsPerThread);
+    ~BinaryLogWriter();
+
+    BinaryLogWriter(const BinaryLogWriter &) = delete;
+    BinaryLogWriter &operator=(const BinaryLogWriter &) = delete;
+
+    void logApiCall(const char *function, bool enter, int32_t errorCode);
+    void logMessage(const std::string &message);
+    void flush();
+
+    size_t getThreadBuffersCount() const;
+
+  protected:
+    void push(BinaryLogRecordType type, int32_t value, const char *text, size_t textLength);
+    BinaryLogRingBuffer &getThreadBuffer();
+    void flushThreadFunc();
+
+    std::unique_ptr<std::ostream> out;
+    const size_t recordsPerThread;
+    const uint64_t writerId;
+
+    mutable std::mutex buffersMutex;
+    std::vector<std::unique_ptr<BinaryLogRingBuffer>> threadBuffers;
+
+    std::mutex drainMutex;
+    std::vector<BinaryLogRecord> drainedRecords;
+
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool stopRequested = false;
+    std::thread flushThread;
+};
+
+struct BinaryLogDecoder {
+    static bool decode(std::istream &in, std::ostream &out);
+};
+} // namespace OCLRT
@@ -9,10 +9,12 @@
 #include "runtime/helpers/aligned_memory.h"
 #include "runtime/helpers/debug_helpers.h"
 
-#include <algorithm>
 #include <cstdint>
-#include <unordered_map>
-#include <vector>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
 
 namespace OCLRT {
 
@@ -24,6 +26,95 @@ struct HeapChunk {
 
 bool operator<(const HeapChunk &hc1, const HeapChunk &hc2);
 
+// Free chunks indexed both by address (for coalescing) and by size (for best fit).
+// Adjacent chunks are always merged on store, so no two stored chunks touch each other.
+class FreeChunks {
+  public:
+    size_t size() const { return chunksByAddress.size(); }
+    bool empty() const { return chunksByAddress.empty(); }
+
+    size_t getChunkSize(uint64_t ptr) const {
+        auto it = chunksByAddress.find(ptr);
+        return it == chunksByAddress.end() ? 0u : it->second;
+    }
+
+    void store(uint64_t ptr, size_t size) {
+        auto next = chunksByAddress.lower_bound(ptr);
+        if (next != chunksByAddress.end() && next->first == ptr + size) {
+            size += next->second;
+            eraseChunk(next++);
+        }
+        if (next != chunksByAddress.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == ptr) {
+                ptr = prev->first;
+                size += prev->second;
+                eraseChunk(prev);
+            }
+        }
+        insertChunk(ptr, size);
+    }
+
+    bool getBestFit(size_t size, HeapChunk &chunk) const {
+        auto it = chunksBySize.lower_bound(std::make_pair(size, static_cast<uint64_t>(0u)));
+        if (it == chunksBySize.end()) {
+            return false;
+        }
+        chunk.size = it->first;
+        chunk.ptr = it->second;
+        return true;
+    }
+
+    void resize(uint64_t ptr, size_t newSize) {
+        auto it = chunksByAddress.find(ptr);
+        DEBUG_BREAK_IF(it == chunksByAddress.end());
+        eraseChunk(it);
+        if (newSize > 0) {
+            insertChunk(ptr, newSize);
+        }
+    }
+
+    bool takeChunkStartingAt(uint64_t ptr, size_t &size) {
+        auto it = chunksByAddress.find(ptr);
+        if (it == chunksByAddress.end()) {
+            return false;
+        }
+        size = it->second;
+        eraseChunk(it);
+        return true;
+    }
+
+    bool takeChunkEndingAt(uint64_t end, uint64_t &ptr) {
+        auto it = chunksByAddress.lower_bound(end);
+        if (it == chunksByAddress.begin()) {
+            return false;
+        }
+        --it;
+        if (it->first + it->second != end) {
+            return false;
+        }
+        ptr = it->first;
+        eraseChunk(it);
+        return true;
+    }
+
+  protected:
+    using AddressIterator = std::map<uint64_t, size_t>::iterator;
+
+    void insertChunk(uint64_t ptr, size_t size) {
+        chunksByAddress.emplace(ptr, size);
+        chunksBySize.emplace(size, ptr);
+    }
+
+    void eraseChunk(AddressIterator it) {
+        chunksBySize.erase(std::make_pair(it->second, it->first));
+        chunksByAddress.erase(it);
+    }
+
+    std::map<uint64_t, size_t> chunksByAddress;
+    std::set<std::pair<size_t, uint64_t>> chunksBySize;
+};
+
 class HeapAllocator {
   public:
     HeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, 4 * MemoryConstants::megaByte) {
@@ -32,8 +123,6 @@ class HeapAllocator {
     HeapAllocator(uint64_t address, uint64_t size, size_t threshold) : size(size), availableSize(size), sizeThreshold(threshold) {
         pLeftBound = address;
         pRightBound = address + size;
-        freedChunksBig.reserve(10);
-        freedChunksSmall.reserve(50);
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -45,42 +134,34 @@ class HeapAllocator {
             return 0llu;
         }
 
-        std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
-        uint32_t defragmentCount = 0;
-
-        for (;;) {
-            size_t sizeOfFreedChunk = 0;
-            uint64_t ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk);
-
-            if (ptrReturn == 0llu) {
-                if (sizeToAllocate > sizeThreshold) {
-                    if (pLeftBound + sizeToAllocate <= pRightBound) {
-                        ptrReturn = pLeftBound;
-                        pLeftBound += sizeToAllocate;
-                    }
-                } else {
-                    if (pRightBound - sizeToAllocate >= pLeftBound) {
-                        pRightBound -= sizeToAllocate;
-                        ptrReturn = pRightBound;
-                    }
-                }
-            }
+        FreeChunks &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
+
+        size_t sizeOfFreedChunk = 0;
+        uint64_t ptrReturn = getFromFreedChunks(sizeToAllocate, freedChunks, sizeOfFreedChunk);
 
-            if (ptrReturn != 0llu) {
-                if (sizeOfFreedChunk > 0) {
-                    availableSize -= sizeOfFreedChunk;
-                    sizeToAllocate = sizeOfFreedChunk;
-                } else {
-                    availableSize -= sizeToAllocate;
+        if (ptrReturn == 0llu) {
+            if (sizeToAllocate > sizeThreshold) {
+                if (pLeftBound + sizeToAllocate <= pRightBound) {
+                    ptrReturn = pLeftBound;
+                    pLeftBound += sizeToAllocate;
+                }
+            } else {
+                if (pRightBound - sizeToAllocate >= pLeftBound) {
+                    pRightBound -= sizeToAllocate;
+                    ptrReturn = pRightBound;
                 }
-                return ptrReturn;
             }
+        }
 
-            if (defragmentCount == 1)
-                return 0llu;
-            defragment();
-            defragmentCount++;
+        if (ptrReturn != 0llu) {
+            if (sizeOfFreedChunk > 0) {
+                availableSize -= sizeOfFreedChunk;
+                sizeToAllocate = sizeOfFreedChunk;
+            } else {
+                availableSize -= sizeToAllocate;
+            }
         }
+        return ptrReturn;
     }
 
     void free(uint64_t ptr, size_t size) {
@@ -98,9 +179,9 @@ class HeapAllocator {
             mergeLastFreedBig();
         } else if (ptr < pLeftBound) {
             DEBUG_BREAK_IF(size <= sizeThreshold);
-            storeInFreedChunks(ptr, size, freedChunksBig);
+            freedChunksBig.store(ptr, size);
         } else {
-            storeInFreedChunks(ptr, size, freedChunksSmall);
+            freedChunksSmall.store(ptr, size);
         }
         availableSize += size;
     }
@@ -126,124 +207,46 @@ class HeapAllocator {
     const size_t sizeThreshold;
     size_t allocationAlignment = MemoryConstants::pageSize;
 
-    std::vector<HeapChunk> freedChunksSmall;
-    std::vector<HeapChunk> freedChunksBig;
+    FreeChunks freedChunksSmall;
+    FreeChunks freedChunksBig;
     std::mutex mtx;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk) {
-        size_t elements = freedChunks.size();
-        size_t bestFitIndex = -1;
-        size_t bestFitSize = 0;
+    uint64_t getFromFreedChunks(size_t size, FreeChunks &freedChunks, size_t &sizeOfFreedChunk) {
+        HeapChunk bestFit(0llu, 0u);
         sizeOfFreedChunk = 0;
 
-        for (size_t i = 0; i < elements; i++) {
-            if (freedChunks[i].size == size) {
-                auto ptr = freedChunks[i].ptr;
-                freedChunks.erase(freedChunks.begin() + i);
-                return ptr;
-            }
-
-            if (freedChunks[i].size > size) {
-                if (freedChunks[i].size < bestFitSize || bestFitSize == 0) {
-                    bestFitIndex = i;
-                    bestFitSize = freedChunks[i].size;
-                }
-            }
+        if (!freedChunks.getBestFit(size, bestFit)) {
+            return 0llu;
         }
 
-        if (bestFitSize != 0) {
-            if (bestFitSize < (size << 1)) {
-                auto ptr = freedChunks[bestFitIndex].ptr;
-                sizeOfFreedChunk = freedChunks[bestFitIndex].size;
-                freedChunks.erase(freedChunks.begin() + bestFitIndex);
-                return ptr;
-            } else {
-                size_t sizeDelta = freedChunks[bestFitIndex].size - size;
-
-                DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
-
-                auto ptr = freedChunks[bestFitIndex].ptr + sizeDelta;
-                freedChunks[bestFitIndex].size = sizeDelta;
-                return ptr;
+        if (bestFit.size < (size << 1)) {
+            freedChunks.resize(bestFit.ptr, 0u);
+            if (bestFit.size != size) {
+                sizeOfFreedChunk = bestFit.size;
             }
+            return bestFit.ptr;
         }
-        return 0llu;
-    }
 
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
-            }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
-            }
-        }
+        size_t sizeDelta = bestFit.size - size;
+
+        DEBUG_BREAK_IF(!(size <= sizeThreshold || (size > sizeThreshold && sizeDelta > sizeThreshold)));
 
-        freedChunks.emplace_back(ptr, size);
+        freedChunks.resize(bestFit.ptr, sizeDelta);
+        return bestFit.ptr + sizeDelta;
     }
 
     void mergeLastFreedSmall() {
-        size_t maxSizeOfSmallChunks = freedChunksSmall.size();
-
-        if (maxSizeOfSmallChunks > 0) {
-            auto ptr = freedChunksSmall[maxSizeOfSmallChunks - 1].ptr;
-            size_t chunkSize = freedChunksSmall[maxSizeOfSmallChunks - 1].size;
-            if (ptr == pRightBound) {
-                pRightBound = ptr + chunkSize;
-                freedChunksSmall.pop_back();
-            }
+        size_t chunkSize = 0;
+        if (freedChunksSmall.takeChunkStartingAt(pRightBound, chunkSize)) {
+            pRightBound += chunkSize;
         }
     }
 
     void mergeLastFreedBig() {
-        size_t maxSizeOfBigChunks = freedChunksBig.size();
-
-        if (maxSizeOfBigChunks > 0) {
-            auto ptr = freedChunksBig[maxSizeOfBigChunks - 1].ptr;
-            size_t chunkSize = freedChunksBig[maxSizeOfBigChunks - 1].size;
-            if (ptr == pLeftBound - chunkSize) {
-                pLeftBound = ptr;
-                freedChunksBig.pop_back();
-            }
-        }
-    }
-
-    void defragment() {
-
-        if (freedChunksSmall.size() > 1) {
-            std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
-            size_t maxSize = freedChunksSmall.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksSmall[i].ptr;
-                size_t chunkSize = freedChunksSmall[i].size;
-
-                if (freedChunksSmall[i - 1].ptr == ptr + chunkSize) {
-                    freedChunksSmall[i - 1].ptr = ptr;
-                    freedChunksSmall[i - 1].size += chunkSize;
-                    freedChunksSmall.erase(freedChunksSmall.begin() + i);
-                }
-            }
-        }
-        mergeLastFreedSmall();
-        if (freedChunksBig.size() > 1) {
-            std::sort(freedChunksBig.begin(), freedChunksBig.end());
-
-            size_t maxSize = freedChunksBig.size();
-            for (size_t i = maxSize - 1; i > 0; --i) {
-                auto ptr = freedChunksBig[i].ptr;
-                size_t chunkSize = freedChunksBig[i].size;
-                if ((freedChunksBig[i - 1].ptr + freedChunksBig[i - 1].size) == ptr) {
-                    freedChunksBig[i - 1].size += chunkSize;
-                    freedChunksBig.erase(freedChunksBig.begin() + i);
-                }
-            }
+        uint64_t ptr = 0llu;
+        if (freedChunksBig.takeChunkEndingAt(pLeftBound, ptr)) {
+            pLeftBound = ptr;
         }
-        mergeLastFreedBig();
-        DBG_LOG(PrintDebugMessages, __FUNCTION__, "Allocator usage == ", this->getUsage());
     }
 };
 } // namespace OCLRT
@@ -33,6 +33,16 @@ class RefCounter {
         ((void)(curr));
     }
 
+    bool incIfNotZero() {
+        CT curr = val.load();
+        while (curr > 0) {
+            if (val.compare_exchange_weak(curr, curr + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool dec() {
         CT curr = --val;
         DEBUG_BREAK_IF(curr < 0);
@@ -131,6 +141,11 @@ class ReferenceTrackedObject {
         refInternal.inc();
     }
 
+    // fails if the object is already being destroyed
+    bool tryIncRefInternal() {
+        return refInternal.incIfNotZero();
+    }
+
     unique_ptr_if_unused<DerivedClass> decRefInternal() {
         auto customDeleter = tryGetCustomDeleter();
         auto current = refInternal.decAndReturnCurrent();
@@ -10,10 +10,15 @@
 #include "runtime/helpers/debug_helpers.h"
 #include "runtime/memory_manager/memory_manager.h"
 #include "runtime/utilities/idlist.h"
+#include "runtime/utilities/spinlock.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace OCLRT {
@@ -46,14 +51,31 @@ struct TagNode : public IDNode<TagNode<TagType>> {
     friend class TagAllocator;
 };
 
+struct TagAllocatorStatistics {
+    size_t poolSize = 0u;
+    size_t usedTags = 0u;
+    size_t deferredTags = 0u;
+    uint64_t magazineRefills = 0u;
+    uint64_t poolAllocations = 0u;
+};
+
+// Tags are handed out from small per-thread magazines. A thread only touches the
+// shared pool (guarded by allocatorMutex) when its magazine runs empty or overflows,
+// and then moves a whole batch of tags at once.
 template <typename TagType>
 class TagAllocator {
   public:
     using NodeType = TagNode<TagType>;
 
+    static const size_t magazinesCount = 16;
+    static const size_t magazineBatchSize = 16;
+
     TagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : memoryManager(memMngr),
                                                                                  tagCount(tagCount),
                                                                                  tagAlignment(tagAlignment) {
+        for (auto &magazine : magazines) {
+            magazine.nodes.reserve(2 * magazineBatchSize);
+        }
         populateFreeTags();
     }
 
@@ -62,6 +84,12 @@ class TagAllocator {
     }
 
     void cleanUpResources() {
+        for (auto &magazine : magazines) {
+            magazine.nodes.clear();
+        }
+        freeTags.clear();
+        deferredTags.detachNodes();
+
         for (auto gfxAllocation : gfxAllocations) {
             memoryManager->freeGraphicsMemory(gfxAllocation);
         }
@@ -74,16 +102,19 @@ class TagAllocator {
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
+        auto &magazine = getMagazine();
+        NodeType *node = nullptr;
+        {
+            std::lock_guard<SpinLock> lock(magazine.lock);
+            if (!magazine.nodes.empty()) {
+                node = magazine.nodes.back();
+                magazine.nodes.pop_back();
+            }
         }
-        NodeType *node = freeTags.removeFrontOne().release();
-        if (!node) {
-            std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
-            node = freeTags.removeFrontOne().release();
+        if (node == nullptr) {
+            node = refillMagazine(magazine);
         }
-        usedTags.pushFrontOne(*node);
+        usedTagsCount++;
         node->incRefCount();
         node->tagForCpuAccess->initialize();
         return node;
@@ -91,6 +122,7 @@ class TagAllocator {
 
     MOCKABLE_VIRTUAL void returnTag(NodeType *node) {
         if (node->refCount.fetch_sub(1) == 1) {
+            usedTagsCount--;
             if (node->tagForCpuAccess->canBeReleased()) {
                 returnTagToFreePool(node);
             } else {
@@ -99,9 +131,24 @@ class TagAllocator {
         }
     }
 
+    TagAllocatorStatistics getStatistics() const {
+        TagAllocatorStatistics statistics;
+        statistics.poolSize = poolSize.load();
+        statistics.usedTags = usedTagsCount.load();
+        statistics.deferredTags = deferredTagsCount.load();
+        statistics.magazineRefills = magazineRefills.load();
+        statistics.poolAllocations = gfxAllocationsCount.load();
+        return statistics;
+    }
+
   protected:
-    IDList<NodeType> freeTags;
-    IDList<NodeType> usedTags;
+    struct Magazine {
+        SpinLock lock;
+        std::vector<NodeType *> nodes;
+    };
+
+    std::array<Magazine, magazinesCount> magazines;
+    std::vector<NodeType *> freeTags;
     IDList<NodeType> deferredTags;
     std::vector<GraphicsAllocation *> gfxAllocations;
     std::vector<NodeType *> tagPoolMemory;
@@ -112,17 +159,55 @@ class TagAllocator {
 
     std::mutex allocatorMutex;
 
+    std::atomic<size_t> poolSize{0u};
+    std::atomic<size_t> usedTagsCount{0u};
+    std::atomic<size_t> deferredTagsCount{0u};
+    std::atomic<uint64_t> magazineRefills{0u};
+    std::atomic<uint64_t> gfxAllocationsCount{0u};
+
+    Magazine &getMagazine() {
+        return magazines[std::hash<std::thread::id>()(std::this_thread::get_id()) % magazinesCount];
+    }
+
     MOCKABLE_VIRTUAL void returnTagToFreePool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(usedNode == nullptr);
-        ((void)(usedNode));
-        freeTags.pushFrontOne(*node);
+        auto &magazine = getMagazine();
+        std::lock_guard<SpinLock> lock(magazine.lock);
+        magazine.nodes.push_back(node);
+        if (magazine.nodes.size() >= 2 * magazineBatchSize) {
+            auto batchEnd = magazine.nodes.begin() + magazineBatchSize;
+            std::lock_guard<std::mutex> poolLock(allocatorMutex);
+            freeTags.insert(freeTags.end(), magazine.nodes.begin(), batchEnd);
+            magazine.nodes.erase(magazine.nodes.begin(), batchEnd);
+        }
     }
 
     void returnTagToDeferredPool(NodeType *node) {
-        NodeType *usedNode = usedTags.removeOne(*node).release();
-        DEBUG_BREAK_IF(!usedNode);
-        deferredTags.pushFrontOne(*usedNode);
+        deferredTagsCount++;
+        deferredTags.pushTailOne(*node);
+    }
+
+    // Moves a batch of tags from the shared pool to the magazine and returns one of them to the caller.
+    // Caller must not hold magazine.lock, growing the pool allocates graphics memory.
+    NodeType *refillMagazine(Magazine &magazine) {
+        std::array<NodeType *, magazineBatchSize> batch;
+        size_t batchSize = 0;
+        {
+            std::lock_guard<std::mutex> lock(allocatorMutex);
+            if (freeTags.empty()) {
+                reclaimDeferredTags();
+            }
+            if (freeTags.empty()) {
+                populateFreeTags();
+            }
+            batchSize = std::min(freeTags.size(), magazineBatchSize);
+            std::copy(freeTags.end() - batchSize, freeTags.end(), batch.begin());
+            freeTags.resize(freeTags.size() - batchSize);
+            magazineRefills++;
+        }
+
+        std::lock_guard<SpinLock> lock(magazine.lock);
+        magazine.nodes.insert(magazine.nodes.end(), batch.begin(), batch.begin() + batchSize - 1);
+        return batch[batchSize - 1];
     }
 
     void populateFreeTags() {
@@ -146,35 +231,48 @@ class TagAllocator {
             nodesMemory[i].gfxAllocation = graphicsAllocation;
             nodesMemory[i].tagForCpuAccess = reinterpret_cast<TagType *>(Start);
             nodesMemory[i].gpuAddress = gpuBaseAddress + (i * tagSize);
-            freeTags.pushTailOne(nodesMemory[i]);
             Start += tagSize;
         }
         DEBUG_BREAK_IF(Start > End);
         ((void)(End));
+
+        // free tags are taken from the back, hand out the first tag of the pool first
+        for (size_t i = nodeCount; i > 0; --i) {
+            freeTags.push_back(&nodesMemory[i - 1]);
+        }
         tagPoolMemory.push_back(nodesMemory);
+        poolSize += nodeCount;
+        gfxAllocationsCount++;
     }
 
     void releaseDeferredTags() {
-        IDList<NodeType, false> pendingFreeTags;
-        IDList<NodeType, false> pendingDeferredTags;
-        auto currentNode = deferredTags.detachNodes();
-
-        while (currentNode != nullptr) {
-            auto nextNode = currentNode->next;
-            if (currentNode->tagForCpuAccess->canBeReleased()) {
-                pendingFreeTags.pushFrontOne(*currentNode);
+        std::lock_guard<std::mutex> lock(allocatorMutex);
+        reclaimDeferredTags();
+    }
+
+    // Caller must hold allocatorMutex. Stops once a magazine batch is reclaimed or every deferred
+    // tag was checked once, tags that are still in use are rotated to the back of the deferred list.
+    void reclaimDeferredTags() {
+        auto nodesToCheck = deferredTagsCount.load();
+        size_t reclaimedCount = 0;
+        for (size_t i = 0; i < nodesToCheck && reclaimedCount < magazineBatchSize; i++) {
+            auto node = deferredTags.removeFrontOne().release();
+            if (node == nullptr) {
+                break;
+            }
+            if (node->tagForCpuAccess->canBeReleased()) {
+                deferredTagsCount--;
+                freeTags.push_back(node);
+                reclaimedCount++;
             } else {
-                pendingDeferredTags.pushFrontOne(*currentNode);
+                deferredTags.pushTailOne(*node);
             }
-            currentNode = nextNode;
-        }
-
-        if (!pendingFreeTags.peekIsEmpty()) {
-            freeTags.splice(*pendingFreeTags.detachNodes());
-        }
-        if (!pendingDeferredTags.peekIsEmpty()) {
-            deferredTags.splice(*pendingDeferredTags.detachNodes());
         }
     }
 };
+
+template <typename TagType>
+const size_t TagAllocator<TagType>::magazinesCount;
+template <typename TagType>
+const size_t TagAllocator<TagType>::magazineBatchSize;
 } // namespace OCLRT
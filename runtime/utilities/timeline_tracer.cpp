@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/timeline_tracer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+
+namespace OCLRT {
+
+constexpr size_t TimelineTracer::defaultRecordsPerThread;
+TimelineTracer *TimelineTracer::globalTracer = nullptr;
+
+namespace {
+std::once_flag globalTracerCreated;
+std::atomic<uint64_t> tracersCount{0};
+std::atomic<uint64_t> tracedThreadsCount{0};
+
+struct ThreadBufferCache {
+    uint64_t tracerId = 0;
+    TimelineRingBuffer *buffer = nullptr;
+};
+thread_local ThreadBufferCache threadBufferCache;
+
+uint64_t getTracedThreadId() {
+    thread_local uint64_t threadId = ++tracedThreadsCount;
+    return threadId;
+}
+
+void writeMicroseconds(std::ostream &out, uint64_t ns) {
+    out << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+void writeEscaped(std::ostream &out, const char *text) {
+    for (; *text != '\0'; text++) {
+        if (*text == '"' || *text == '\\') {
+            out << '\\';
+        }
+        out << *text;
+    }
+}
+} // namespace
+
+void TimelineRingBuffer::copyRecords(std::vector<TimelineRecord> &output) const {
+    auto writtenCount = getWrittenCount();
+    auto capacity = records.size();
+    auto first = writtenCount > capacity ? writtenCount - capacity : 0;
+    for (auto position = first; position < writtenCount; position++) {
+        output.push_back(records[position % capacity]);
+    }
+}
+
+TimelineTracer::TimelineTracer(size_t recordsPerThread)
+    : recordsPerThread(std::max(recordsPerThread, static_cast<size_t>(1))), tracerId(++tracersCount) {
+}
+
+TimelineTracer &TimelineTracer::get() {
+    std::call_once(globalTracerCreated, []() {
+        // never destroyed, traced paths of other threads and static destructors may still run at exit
+        globalTracer = new TimelineTracer();
+        globalTracer->dumpFileName = DebugManager.flags.TimelineTraceFile.get();
+        std::atexit(dumpGlobalTracer);
+    });
+    return *globalTracer;
+}
+
+void TimelineTracer::dumpGlobalTracer() {
+    globalTracer->dumpToFile();
+}
+
+uint64_t TimelineTracer::getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void TimelineTracer::record(const char *name, TimelineTrack track, uint64_t startNs, uint64_t durationNs, uint64_t argument) {
+    auto &buffer = getThreadBuffer();
+    buffer.push({name, startNs, durationNs, argument, buffer.getThreadId(), track});
+}
+
+TimelineRingBuffer &TimelineTracer::getThreadBuffer() {
+    if (threadBufferCache.tracerId == tracerId) {
+        return *threadBufferCache.buffer;
+    }
+
+    auto threadId = getTracedThreadId();
+    std::lock_guard<std::mutex> autolock(buffersMutex);
+    auto buffer = std::find_if(threadBuffers.begin(), threadBuffers.end(), [=](const std::unique_ptr<TimelineRingBuffer> &threadBuffer) {
+        return threadBuffer->getThreadId() == threadId;
+    });
+    if (buffer == threadBuffers.end()) {
+        threadBuffers.push_back(std::unique_ptr<TimelineRingBuffer>(new TimelineRingBuffer(recordsPerThread, threadId)));
+        buffer = threadBuffers.end() - 1;
+    }
+    threadBufferCache.tracerId = tracerId;
+    threadBufferCache.buffer = buffer->get();
+    return **buffer;
+}
+
+size_t TimelineTracer::getThreadBuffersCount() const {
+    std::lock_guard<std::mutex> autolock(buffersMutex);
+    return threadBuffers.size();
+}
+
+void TimelineTracer::dump(std::ostream &out) const {
+    std::vector<TimelineRecord> records;
+    {
+        std::lock_guard<std::mutex> autolock(buffersMutex);
+        for (auto &threadBuffer : threadBuffers) {
+            threadBuffer->copyRecords(records);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(), [](const TimelineRecord &left, const TimelineRecord &right) {
+        return left.startNs < right.startNs;
+    });
+
+    out << "{\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Host\"}},\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}}";
+    for (auto &record : records) {
+        auto gpuRecord = record.track == TimelineTrack::Gpu;
+        out << ",\n{\"name\":\"";
+        writeEscaped(out, record.name);
+        out << "\",\"ph\":\"X\",\"pid\":" << (gpuRecord ? 1 : 0) << ",\"tid\":" << (gpuRecord ? 0 : record.threadId) << ",\"ts\":";
+        writeMicroseconds(out, record.startNs);
+        out << ",\"dur\":";
+        writeMicroseconds(out, record.durationNs);
+        out << ",\"args\":{\"value\":" << record.argument << "}}";
+    }
+    out << "\n]}\n";
+}
+
+std::unique_ptr<std::ostream> TimelineTracer::createDumpStream(const std::string &filename) {
+    return std::unique_ptr<std::ostream>(new std::ofstream(filename, std::ios::binary));
+}
+
+void TimelineTracer::dumpToFile() {
+    bool recordsPresent = false;
+    {
+        std::lock_guard<std::mutex> autolock(buffersMutex);
+        for (auto &threadBuffer : threadBuffers) {
+            recordsPresent |= threadBuffer->getWrittenCount() != 0;
+        }
+    }
+    if (!recordsPresent) {
+        return;
+    }
+    auto out = createDumpStream(dumpFileName);
+    if (out && out->good()) {
+        dump(*out);
+    }
+}
+} // namespace OCLRT
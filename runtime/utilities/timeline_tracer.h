@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/os_interface/debug_settings_manager.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace OCLRT {
+
+enum class TimelineTrack : uint32_t {
+    Host = 0,
+    Gpu = 1
+};
+
+struct TimelineRecord {
+    const char *name;
+    uint64_t startNs;
+    uint64_t durationNs;
+    uint64_t argument;
+    uint64_t threadId;
+    TimelineTrack track;
+};
+
+// Fixed size buffer written by a single thread only, the oldest records are overwritten when it is full.
+class TimelineRingBuffer {
+  public:
+    TimelineRingBuffer(size_t capacity, uint64_t threadId) : records(capacity), threadId(threadId) {}
+
+    void push(const TimelineRecord &record) {
+        auto position = written.load(std::memory_order_relaxed);
+        records[position % records.size()] = record;
+        written.store(position + 1, std::memory_order_release);
+    }
+
+    void copyRecords(std::vector<TimelineRecord> &output) const;
+
+    size_t getCapacity() const { return records.size(); }
+    uint64_t getWrittenCount() const { return written.load(std::memory_order_acquire); }
+    uint64_t getThreadId() const { return threadId; }
+
+  protected:
+    std::vector<TimelineRecord> records;
+    std::atomic<uint64_t> written{0};
+    const uint64_t threadId;
+};
+
+class TimelineTracer {
+  public:
+    static constexpr size_t defaultRecordsPerThread = 16384;
+
+    TimelineTracer(size_t recordsPerThread = defaultRecordsPerThread);
+
+    static TimelineTracer &get();
+    static bool isEnabled() { return DebugManager.flags.EnableTimelineTrace.get() != 0; }
+    static uint64_t getTimestampNs();
+
+    void record(const char *name, TimelineTrack track, uint64_t startNs, uint64_t durationNs, uint64_t argument);
+    void dump(std::ostream &out) const;
+    size_t getThreadBuffersCount() const;
+
+  protected:
+    std::unique_ptr<std::ostream> createDumpStream(const std::string &filename);
+    TimelineRingBuffer &getThreadBuffer();
+    void dumpToFile();
+    static void dumpGlobalTracer();
+
+    static TimelineTracer *globalTracer;
+
+    mutable std::mutex buffersMutex;
+    std::vector<std::unique_ptr<TimelineRingBuffer>> threadBuffers;
+    const size_t recordsPerThread;
+    const uint64_t tracerId;
+    std::string dumpFileName;
+};
+
+// Records the lifetime of the scope as a host span when timeline tracing is enabled.
+class TimelineScope {
+  public:
+    TimelineScope(const char *name, uint64_t argument = 0) : name(name), argument(argument) {
+        if (TimelineTracer::isEnabled()) {
+            startNs = TimelineTracer::getTimestampNs();
+            enabled = true;
+        }
+    }
+    ~TimelineScope() {
+        if (enabled) {
+            TimelineTracer::get().record(name, TimelineTrack::Host, startNs, TimelineTracer::getTimestampNs() - startNs, argument);
+        }
+    }
+    TimelineScope(const TimelineScope &) = delete;
+    TimelineScope &operator=(const TimelineScope &) = delete;
+
+  protected:
+    const char *name;
+    uint64_t argument;
+    uint64_t startNs = 0;
+    bool enabled = false;
+};
+} // namespace OCLRT
@@ -71,6 +71,17 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, taskCountShouldBeUpdated) {
     EXPECT_EQ(1u, commandStreamReceiver.peekTaskCount());
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenUnchangedHeapsWhenFlushTaskIsCalledTwiceThenStateBaseAddressIsProgrammedOnce) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(0u, commandStreamReceiver.peekStateBaseAddressProgrammingsCount());
+
+    flushTask(commandStreamReceiver);
+    EXPECT_EQ(1u, commandStreamReceiver.peekStateBaseAddressProgrammingsCount());
+
+    flushTask(commandStreamReceiver);
+    EXPECT_EQ(1u, commandStreamReceiver.peekStateBaseAddressProgrammingsCount());
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenconfigureCSRtoNonDirtyStateWhenFlushTaskIsCalledThenNoCommandsAreAdded) {
     configureCSRtoNonDirtyState<FamilyType>();
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
@@ -329,6 +340,35 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, whenSamplerCacheFlushBeforeThenSen
     waTable->waSamplerCacheFlushBetweenRedescribedSurfaceReads = tmp;
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenIndirectHeapWrappedWithinAllocationWhenFlushTaskIsCalledThenCachesAreInvalidated) {
+    typedef typename FamilyType::PIPE_CONTROL PIPE_CONTROL;
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    configureCSRtoNonDirtyState<FamilyType>();
+
+    auto &heap = commandStreamReceiver.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 10u);
+    heap.getSpace(heap.getAvailableSpace());
+    commandStreamReceiver.recordHeapsUsage(1u);
+    *commandStreamReceiver.getTagAddress() = 1u;
+    commandStreamReceiver.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 4096u);
+    ASSERT_EQ(1u, commandStreamReceiver.peekHeapWrapsCount());
+    EXPECT_TRUE(commandStreamReceiver.heapWrapInvalidationRequired);
+
+    flushTask(commandStreamReceiver);
+    EXPECT_FALSE(commandStreamReceiver.heapWrapInvalidationRequired);
+
+    parseCommands<FamilyType>(commandStreamReceiver.commandStream, 0);
+    bool invalidatingPipeControlFound = false;
+    for (auto &cmd : getCommandsList<PIPE_CONTROL>()) {
+        auto pipeControl = genCmdCast<PIPE_CONTROL *>(cmd);
+        if (pipeControl->getStateCacheInvalidationEnable() &&
+            pipeControl->getTextureCacheInvalidationEnable() &&
+            pipeControl->getConstantCacheInvalidationEnable()) {
+            invalidatingPipeControlFound = true;
+        }
+    }
+    EXPECT_TRUE(invalidatingPipeControlFound);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, whenSamplerCacheFlushBeforeAndWaSamplerCacheFlushBetweenRedescribedSurfaceReadsDasabledThenDontSendPipecontrol) {
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
     commandStreamReceiver.isPreambleSent = true;
@@ -258,6 +258,56 @@ HWTEST_F(CommandStreamReceiverTest, givenCsrWhenReleaseIndirectHeapIsCalledThenH
     EXPECT_EQ(0u, heap.getMaxAvailableSpace());
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenFullHeapUsedByCompletedTaskWhenGetIndirectHeapIsCalledThenHeapWrapsWithinSameAllocation) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto &heap = csr.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 10u);
+    auto allocation = heap.getGraphicsAllocation();
+    auto gpuBase = heap.getHeapGpuBase();
+
+    heap.getSpace(heap.getAvailableSpace());
+    csr.recordHeapsUsage(1u);
+    *csr.getTagAddress() = 1u;
+
+    auto &wrappedHeap = csr.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 4096u);
+    EXPECT_EQ(allocation, wrappedHeap.getGraphicsAllocation());
+    EXPECT_EQ(gpuBase, wrappedHeap.getHeapGpuBase());
+    EXPECT_EQ(0u, wrappedHeap.getUsed());
+    EXPECT_EQ(1u, csr.peekHeapWrapsCount());
+    EXPECT_TRUE(csr.getAllocationsForReuse().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenFullHeapUsedByIncompleteTaskWhenGetIndirectHeapIsCalledThenNewAllocationIsUsed) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto &heap = csr.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 10u);
+    auto allocation = heap.getGraphicsAllocation();
+
+    heap.getSpace(heap.getAvailableSpace());
+    csr.recordHeapsUsage(1u);
+    *csr.getTagAddress() = 0u;
+
+    auto &newHeap = csr.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 4096u);
+    EXPECT_NE(allocation, newHeap.getGraphicsAllocation());
+    EXPECT_EQ(0u, csr.peekHeapWrapsCount());
+    EXPECT_TRUE(csr.getAllocationsForReuse().peekContains(*allocation));
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenIndirectHeapRingDisabledWhenHeapIsFullThenNewAllocationIsUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableIndirectHeapRing.set(0);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto &heap = csr.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 10u);
+    auto allocation = heap.getGraphicsAllocation();
+
+    heap.getSpace(heap.getAvailableSpace());
+    csr.recordHeapsUsage(1u);
+    *csr.getTagAddress() = 1u;
+
+    auto &newHeap = csr.getIndirectHeap(IndirectHeap::DYNAMIC_STATE, 4096u);
+    EXPECT_NE(allocation, newHeap.getGraphicsAllocation());
+    EXPECT_EQ(0u, csr.peekHeapWrapsCount());
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenCsrWhenAllocateHeapMemoryIsCalledThenHeapMemoryIsAllocated) {
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
     IndirectHeap *dsh = nullptr;
@@ -19,6 +19,8 @@
 using namespace OCLRT;
 
 struct MockSubmissionAggregator : public SubmissionAggregator {
+    using SubmissionAggregator::lastMergedCommandBuffersCount;
+
     CommandBufferList &peekCommandBuffersList() {
         return this->cmdBuffers;
     }
@@ -543,6 +545,97 @@ TEST(SubmissionsAggregator, givenMultipleOsContextsWhenAggregatingGraphicsAlloca
     }
 }
 
+TEST(SubmissionsAggregator, givenAggregatedCommandBuffersWhenStatisticsAreQueriedThenMergedBuffersAndResidentBytesAreReturned) {
+    MockSubmissionAggregator submissionsAggregator;
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+
+    MockGraphicsAllocation alloc1(nullptr, 1);
+    MockGraphicsAllocation alloc2(nullptr, 2);
+
+    cmdBuffer->surfaces.push_back(&alloc1);
+    cmdBuffer2->surfaces.push_back(&alloc1);
+    cmdBuffer2->surfaces.push_back(&alloc2);
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+
+    size_t totalUsedSize = 0;
+    size_t totalMemoryBudget = -1;
+    ResourcePackage resourcePackage;
+    submissionsAggregator.aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, 0u);
+
+    auto &statistics = submissionsAggregator.getStatistics();
+    EXPECT_EQ(1u, statistics.execsCount);
+    EXPECT_EQ(2u, statistics.mergedCommandBuffersCount);
+    EXPECT_EQ(3u, statistics.residentBytes);
+}
+
+TEST(SubmissionsAggregator, givenMaxCommandBuffersPerExecWhenAggregateIsCalledThenOnlyThatManyCommandBuffersAreAggregated) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setMaxCommandBuffersPerExec(2u);
+
+    std::unique_ptr<Device> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    CommandBuffer *cmdBuffer = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer2 = new CommandBuffer(*device);
+    CommandBuffer *cmdBuffer3 = new CommandBuffer(*device);
+
+    submissionsAggregator.recordCommandBuffer(cmdBuffer);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer2);
+    submissionsAggregator.recordCommandBuffer(cmdBuffer3);
+
+    size_t totalUsedSize = 0;
+    size_t totalMemoryBudget = -1;
+    ResourcePackage resourcePackage;
+    submissionsAggregator.aggregateCommandBuffers(resourcePackage, totalUsedSize, totalMemoryBudget, 0u);
+
+    EXPECT_EQ(cmdBuffer->inspectionId, cmdBuffer2->inspectionId);
+    EXPECT_NE(cmdBuffer->inspectionId, cmdBuffer3->inspectionId);
+    EXPECT_EQ(2u, submissionsAggregator.getStatistics().mergedCommandBuffersCount);
+}
+
+TEST(SubmissionsAggregator, givenTargetSubmissionLatencyWhenSubmissionIsSlowerThanTargetThenMaxCommandBuffersPerExecIsReduced) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setTargetSubmissionLatency(100);
+    submissionsAggregator.lastMergedCommandBuffersCount = 8u;
+
+    submissionsAggregator.reportSubmissionLatency(200);
+    EXPECT_EQ(4u, submissionsAggregator.getMaxCommandBuffersPerExec());
+
+    submissionsAggregator.lastMergedCommandBuffersCount = 1u;
+    submissionsAggregator.reportSubmissionLatency(200);
+    EXPECT_EQ(1u, submissionsAggregator.getMaxCommandBuffersPerExec());
+}
+
+TEST(SubmissionsAggregator, givenTargetSubmissionLatencyWhenFullBatchIsSubmittedFasterThanTargetThenMaxCommandBuffersPerExecIsIncreased) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.setTargetSubmissionLatency(100);
+    submissionsAggregator.setMaxCommandBuffersPerExec(4u);
+
+    submissionsAggregator.lastMergedCommandBuffersCount = 2u;
+    submissionsAggregator.reportSubmissionLatency(10);
+    EXPECT_EQ(4u, submissionsAggregator.getMaxCommandBuffersPerExec());
+
+    submissionsAggregator.lastMergedCommandBuffersCount = 4u;
+    submissionsAggregator.reportSubmissionLatency(10);
+    EXPECT_EQ(8u, submissionsAggregator.getMaxCommandBuffersPerExec());
+
+    submissionsAggregator.setMaxCommandBuffersPerExec(SubmissionAggregator::maxAdaptiveCommandBuffersPerExec);
+    submissionsAggregator.lastMergedCommandBuffersCount = SubmissionAggregator::maxAdaptiveCommandBuffersPerExec;
+    submissionsAggregator.reportSubmissionLatency(10);
+    EXPECT_EQ(SubmissionAggregator::maxAdaptiveCommandBuffersPerExec, submissionsAggregator.getMaxCommandBuffersPerExec());
+}
+
+TEST(SubmissionsAggregator, givenNoTargetSubmissionLatencyWhenSubmissionLatencyIsReportedThenMaxCommandBuffersPerExecIsNotChanged) {
+    MockSubmissionAggregator submissionsAggregator;
+    submissionsAggregator.lastMergedCommandBuffersCount = 8u;
+
+    submissionsAggregator.reportSubmissionLatency(1000000);
+    EXPECT_EQ(0u, submissionsAggregator.getMaxCommandBuffersPerExec());
+}
+
 struct SubmissionsAggregatorTests : public ::testing::Test {
     void SetUp() override {
         device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
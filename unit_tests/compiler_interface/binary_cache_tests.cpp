@@ -9,17 +9,24 @@
 #include "test.h"
 #include <runtime/compiler_interface/binary_cache.h>
 #include <runtime/helpers/aligned_memory.h>
+#include <runtime/helpers/file_io.h>
 #include <runtime/helpers/hash.h>
 #include <runtime/helpers/hw_info.h>
 #include <runtime/helpers/string.h>
+#include <runtime/os_interface/os_file_lock.h>
 #include <unit_tests/fixtures/device_fixture.h>
 #include <unit_tests/global_environment.h>
+#include <unit_tests/helpers/temporary_directory.h>
 #include <unit_tests/mocks/mock_context.h>
 #include <unit_tests/mocks/mock_program.h>
 
+#include "os_inc.h"
+
 #include <array>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <set>
 
 using namespace OCLRT;
 using namespace std;
@@ -57,6 +64,41 @@ class BinaryCacheMock : public BinaryCache {
     bool loadResult = false;
 };
 
+class BinaryCacheWithSizeLimit : public BinaryCache {
+  public:
+    BinaryCacheWithSizeLimit(uint64_t sizeLimit, const std::string &cacheLocation) {
+        maxCacheSize = sizeLimit;
+        clCacheLocation = cacheLocation;
+    }
+
+    using BinaryCache::clCacheLocation;
+    using BinaryCache::driverVersion;
+    using BinaryCache::getFilePath;
+    using BinaryCache::index;
+    using BinaryCache::indexLockAttempts;
+    using BinaryCache::indexSaveInterval;
+    using BinaryCache::loadIndex;
+    using BinaryCache::readIndexFile;
+    using BinaryCache::saveIndex;
+};
+
+class BinaryCacheWithSizeLimitFixture {
+  public:
+    void SetUp() {
+        cacheDirectory.reset(new TemporaryDirectory("binary_cache_size_limit_tests"));
+    }
+
+    void TearDown() {
+        cacheDirectory.reset();
+    }
+
+    const std::string &getCacheLocation() const {
+        return cacheDirectory->getPath();
+    }
+
+    std::unique_ptr<TemporaryDirectory> cacheDirectory;
+};
+
 class CompilerInterfaceCachedFixture : public DeviceFixture {
   public:
     void SetUp() {
@@ -75,6 +117,7 @@ class CompilerInterfaceCachedFixture : public DeviceFixture {
 typedef Test<BinaryCacheFixture> BinaryCacheHashTests;
 typedef Test<BinaryCacheFixture> BinaryCacheTests;
 typedef Test<CompilerInterfaceCachedFixture> CompilerInterfaceCachedTests;
+typedef Test<BinaryCacheWithSizeLimitFixture> BinaryCacheWithSizeLimitTests;
 
 TEST(HashGeneration, givenMisalignedBufferWhenPassedToUpdateFunctionThenProperPtrDataIsUsed) {
     Hash hash;
@@ -301,6 +344,193 @@ TEST_F(BinaryCacheTests, cacheThenLoad) {
     EXPECT_TRUE(ret);
 }
 
+TEST_F(BinaryCacheTests, givenDefaultCacheThenSizeLimitIsDisabled) {
+    EXPECT_FALSE(cache->isSizeLimitEnabled());
+    EXPECT_EQ(0u, cache->getMaxCacheSize());
+}
+
+TEST_F(BinaryCacheTests, givenCacheWhenLoadingBinariesThenHitsAndMissesAreCounted) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    const char data[16] = {};
+
+    EXPECT_TRUE(cache->cacheBinary("COUNTED_HASH", data, sizeof(data)));
+    EXPECT_TRUE(cache->loadCachedBinary("COUNTED_HASH", program));
+    EXPECT_FALSE(cache->loadCachedBinary("----do-not-exists----", program));
+
+    EXPECT_EQ(1u, cache->getStatistics().hits);
+    EXPECT_EQ(1u, cache->getStatistics().misses);
+    EXPECT_EQ(0u, cache->getStatistics().evictions);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenSizeLimitWhenCachedBinariesExceedItThenLeastRecentlyUsedIsEvicted) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    BinaryCacheWithSizeLimit cache(64u, getCacheLocation());
+    const char data[32] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("LRU_HASH_A", data, sizeof(data)));
+    EXPECT_TRUE(cache.cacheBinary("LRU_HASH_B", data, sizeof(data)));
+    EXPECT_EQ(64u, cache.getCurrentCacheSize());
+
+    EXPECT_TRUE(cache.loadCachedBinary("LRU_HASH_A", program));
+    EXPECT_TRUE(cache.cacheBinary("LRU_HASH_C", data, sizeof(data)));
+
+    EXPECT_EQ(64u, cache.getCurrentCacheSize());
+    EXPECT_EQ(1u, cache.getStatistics().evictions);
+    EXPECT_EQ(0u, cache.index.count("LRU_HASH_B"));
+
+    EXPECT_FALSE(cache.loadCachedBinary("LRU_HASH_B", program));
+    EXPECT_TRUE(cache.loadCachedBinary("LRU_HASH_A", program));
+    EXPECT_TRUE(cache.loadCachedBinary("LRU_HASH_C", program));
+    EXPECT_EQ(3u, cache.getStatistics().hits);
+    EXPECT_EQ(1u, cache.getStatistics().misses);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenBinaryBiggerThanSizeLimitWhenCachingThenItIsRejected) {
+    BinaryCacheWithSizeLimit cache(16u, getCacheLocation());
+    const char data[32] = {};
+
+    EXPECT_FALSE(cache.cacheBinary("TOO_BIG_HASH", data, sizeof(data)));
+    EXPECT_EQ(0u, cache.getCurrentCacheSize());
+    EXPECT_TRUE(cache.index.empty());
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenSavedIndexWhenNewCacheLoadsItThenEntriesAndAccessOrderAreRestored) {
+    const char data[32] = {};
+    {
+        BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+        EXPECT_TRUE(cache.cacheBinary("INDEX_HASH_A", data, sizeof(data)));
+        EXPECT_TRUE(cache.cacheBinary("INDEX_HASH_B", data, 16u));
+    }
+
+    BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+    cache.loadIndex();
+    ASSERT_EQ(2u, cache.index.size());
+    EXPECT_EQ(48u, cache.getCurrentCacheSize());
+    EXPECT_EQ(32u, cache.index["INDEX_HASH_A"].size);
+    EXPECT_EQ(16u, cache.index["INDEX_HASH_B"].size);
+    EXPECT_LT(cache.index["INDEX_HASH_A"].lastAccess, cache.index["INDEX_HASH_B"].lastAccess);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenIndexFromDifferentDriverVersionWhenLoadingThenItsEntriesAreEvicted) {
+    const char data[32] = {};
+    {
+        BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+        cache.driverVersion = "other_driver_version";
+        EXPECT_TRUE(cache.cacheBinary("STALE_HASH", data, sizeof(data)));
+    }
+
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+    cache.loadIndex();
+    EXPECT_TRUE(cache.index.empty());
+    EXPECT_EQ(1u, cache.getStatistics().evictions);
+    EXPECT_FALSE(cache.loadCachedBinary("STALE_HASH", program));
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenCachedFileMissingInIndexWhenLoadingThenItIsCountedAsLeastRecentlyUsed) {
+    const char data[32] = {};
+    {
+        BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+        EXPECT_TRUE(cache.cacheBinary("TRACKED_HASH", data, sizeof(data)));
+        writeDataToFile(cache.getFilePath("UNTRACKED_HASH").c_str(), data, 16u);
+    }
+
+    BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+    cache.loadIndex();
+    ASSERT_EQ(2u, cache.index.size());
+    EXPECT_EQ(48u, cache.getCurrentCacheSize());
+    EXPECT_EQ(16u, cache.index["UNTRACKED_HASH"].size);
+    EXPECT_LT(cache.index["UNTRACKED_HASH"].lastAccess, cache.index["TRACKED_HASH"].lastAccess);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenUntrackedFilesExceedingSizeLimitWhenLoadingThenTheyAreEvicted) {
+    const char data[32] = {};
+    BinaryCacheWithSizeLimit cache(48u, getCacheLocation());
+    writeDataToFile(cache.getFilePath("UNTRACKED_HASH_A").c_str(), data, sizeof(data));
+    writeDataToFile(cache.getFilePath("UNTRACKED_HASH_B").c_str(), data, sizeof(data));
+
+    cache.loadIndex();
+    EXPECT_EQ(1u, cache.index.size());
+    EXPECT_EQ(32u, cache.getCurrentCacheSize());
+    EXPECT_EQ(1u, cache.getStatistics().evictions);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenCachesSharingDirectoryWhenBothSaveIndexThenEntriesOfBothAreKept) {
+    const char data[32] = {};
+    BinaryCacheWithSizeLimit firstCache(128u, getCacheLocation());
+    BinaryCacheWithSizeLimit secondCache(128u, getCacheLocation());
+    firstCache.loadIndex();
+    secondCache.loadIndex();
+
+    EXPECT_TRUE(firstCache.cacheBinary("FIRST_CACHE_HASH", data, sizeof(data)));
+    firstCache.saveIndex();
+    EXPECT_TRUE(secondCache.cacheBinary("SECOND_CACHE_HASH", data, 16u));
+    secondCache.saveIndex();
+
+    EXPECT_EQ(48u, secondCache.getCurrentCacheSize());
+    std::set<std::string> savedHashes;
+    for (auto &savedEntry : secondCache.readIndexFile()) {
+        savedHashes.insert(savedEntry.first);
+    }
+    EXPECT_EQ(2u, savedHashes.size());
+    EXPECT_EQ(1u, savedHashes.count("FIRST_CACHE_HASH"));
+    EXPECT_EQ(1u, savedHashes.count("SECOND_CACHE_HASH"));
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenFewerWritesThanSaveIntervalWhenCachingThenIndexIsSavedOnDestruction) {
+    const char data[32] = {};
+    auto cache = std::make_unique<BinaryCacheWithSizeLimit>(1024u, getCacheLocation());
+    EXPECT_TRUE(cache->cacheBinary("BATCHED_HASH", data, sizeof(data)));
+    EXPECT_TRUE(cache->readIndexFile().empty());
+
+    cache.reset();
+    BinaryCacheWithSizeLimit reader(1024u, getCacheLocation());
+    auto savedEntries = reader.readIndexFile();
+    ASSERT_EQ(1u, savedEntries.size());
+    EXPECT_EQ("BATCHED_HASH", savedEntries[0].first);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenSaveIntervalWritesWhenCachingThenIndexIsSaved) {
+    const char data[32] = {};
+    BinaryCacheWithSizeLimit cache(1024u, getCacheLocation());
+    for (uint32_t i = 0; i < BinaryCacheWithSizeLimit::indexSaveInterval; i++) {
+        EXPECT_TRUE(cache.readIndexFile().empty());
+        EXPECT_TRUE(cache.cacheBinary("BATCHED_HASH_" + std::to_string(i), data, 1u));
+    }
+    EXPECT_EQ(BinaryCacheWithSizeLimit::indexSaveInterval, cache.readIndexFile().size());
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenEvictionWhenCachingThenIndexIsSaved) {
+    const char data[32] = {};
+    BinaryCacheWithSizeLimit cache(32u, getCacheLocation());
+    EXPECT_TRUE(cache.cacheBinary("EVICTED_HASH", data, sizeof(data)));
+    EXPECT_TRUE(cache.cacheBinary("KEPT_HASH", data, sizeof(data)));
+
+    auto savedEntries = cache.readIndexFile();
+    ASSERT_EQ(1u, savedEntries.size());
+    EXPECT_EQ("KEPT_HASH", savedEntries[0].first);
+}
+
+TEST_F(BinaryCacheWithSizeLimitTests, givenIndexLockedByOtherOwnerWhenSavingIndexThenIndexIsNotWritten) {
+    const char data[32] = {};
+    BinaryCacheWithSizeLimit cache(128u, getCacheLocation());
+    cache.indexLockAttempts = 1u;
+    EXPECT_TRUE(cache.cacheBinary("LOCKED_HASH", data, sizeof(data)));
+
+    auto indexFilePath = getCacheLocation() + PATH_SEPARATOR + BinaryCache::indexFileName;
+    auto otherOwnerLock = FileLock::tryLock(indexFilePath + ".lock");
+    ASSERT_NE(nullptr, otherOwnerLock);
+    cache.saveIndex();
+    EXPECT_TRUE(cache.readIndexFile().empty());
+
+    otherOwnerLock.reset();
+    cache.saveIndex();
+    EXPECT_EQ(1u, cache.readIndexFile().size());
+}
+
 TEST_F(CompilerInterfaceCachedTests, canInjectCache) {
     std::unique_ptr<BinaryCache> cache(new BinaryCache());
     auto res1 = pCompilerInterface->replaceBinaryCache(cache.get());
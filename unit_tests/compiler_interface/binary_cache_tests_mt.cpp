@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/binary_cache.h"
+#include "runtime/execution_environment/execution_environment.h"
+#include "unit_tests/helpers/temporary_directory.h"
+#include "unit_tests/mocks/mock_program.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace OCLRT;
+
+class BinaryCacheInDirectory : public BinaryCache {
+  public:
+    BinaryCacheInDirectory(const std::string &cacheLocation) {
+        clCacheLocation = cacheLocation;
+    }
+};
+
+struct BinaryCacheTestMt : public ::testing::Test {
+    static const int threadCount = 8;
+    static const int binariesPerThread = 16;
+
+    void SetUp() override {
+        cacheDirectory.reset(new TemporaryDirectory("binary_cache_mt_tests"));
+    }
+
+    void TearDown() override {
+        cacheDirectory.reset();
+    }
+
+    static void cacheAndLoad(BinaryCache *cache, int threadId, std::atomic<bool> *start, std::atomic<int> *failures) {
+        ExecutionEnvironment executionEnvironment;
+        MockProgram program(executionEnvironment);
+        char data[64];
+        while (!*start)
+            ;
+        for (int i = 0; i < binariesPerThread; i++) {
+            // half of the hashes are shared by all threads to race on the same files
+            auto hashId = (i % 2) ? threadId * binariesPerThread + i : i;
+            auto hash = "MT_HASH_" + std::to_string(hashId);
+            memset(data, hashId, sizeof(data));
+            if (!cache->cacheBinary(hash, data, sizeof(data))) {
+                (*failures)++;
+            }
+            if (!cache->loadCachedBinary(hash, program)) {
+                (*failures)++;
+            }
+        }
+    }
+
+    std::unique_ptr<TemporaryDirectory> cacheDirectory;
+};
+
+TEST_F(BinaryCacheTestMt, givenManyThreadsWhenCachingAndLoadingBinariesConcurrentlyThenEveryOperationSucceeds) {
+    BinaryCacheInDirectory cache(cacheDirectory->getPath());
+    std::atomic<bool> start{false};
+    std::atomic<int> failures{0};
+    std::thread threads[threadCount];
+
+    for (int i = 0; i < threadCount; i++) {
+        threads[i] = std::thread(cacheAndLoad, &cache, i, &start, &failures);
+    }
+    start = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, failures);
+    EXPECT_EQ(static_cast<uint64_t>(threadCount * binariesPerThread), cache.getStatistics().hits);
+    EXPECT_EQ(0u, cache.getStatistics().misses);
+}
@@ -13,6 +13,9 @@
 #include "test.h"
 #include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/mocks/mock_async_event_handler.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
 
 #include "gmock/gmock.h"
 
@@ -367,3 +370,89 @@ TEST_F(AsyncEventsHandlerTests, asyncProcessCallsProcessListBeforeReturning) {
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWithCallbacksWhenProcessedThenOnlyEventsWithReachedTaskCountAreUpdated) {
+    struct CountingEvent : Event {
+        CountingEvent(CommandQueue *cmdQueue, uint32_t taskCount)
+            : Event(cmdQueue, CL_COMMAND_NDRANGE_KERNEL, 0, taskCount) {}
+
+        void updateExecutionStatus() override {
+            updateCount++;
+            Event::updateExecutionStatus();
+        }
+
+        uint32_t updateCount = 0u;
+    };
+
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+    MockCommandQueue cmdQ(&context, device.get(), nullptr);
+    auto tagAddress = cmdQ.getCommandStreamReceiver().getTagAddress();
+    *tagAddress = 0u;
+
+    int event1Counter(0), event2Counter(0);
+    auto submittedEvent1 = new CountingEvent(&cmdQ, 1u);
+    auto submittedEvent2 = new CountingEvent(&cmdQ, 2u);
+    submittedEvent1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    submittedEvent2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    submittedEvent1->updateCount = 0u;
+    submittedEvent2->updateCount = 0u;
+
+    handler->registerEvent(submittedEvent2);
+    handler->registerEvent(submittedEvent1);
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(submittedEvent1, sleepCandidate);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+    EXPECT_EQ(2u, handler->submittedEventsCount);
+
+    sleepCandidate = handler->process();
+    EXPECT_EQ(submittedEvent1, sleepCandidate);
+    EXPECT_EQ(1u, submittedEvent1->updateCount);
+    EXPECT_EQ(1u, submittedEvent2->updateCount);
+
+    *tagAddress = 1u;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(submittedEvent2, sleepCandidate);
+    EXPECT_EQ(2u, submittedEvent1->updateCount);
+    EXPECT_EQ(1u, submittedEvent2->updateCount);
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_EQ(0, event2Counter);
+    EXPECT_EQ(1u, handler->submittedEventsCount);
+
+    *tagAddress = 2u;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(0u, handler->submittedEventsCount);
+    EXPECT_TRUE(handler->submittedEvents.empty());
+    EXPECT_TRUE(handler->peekIsListEmpty());
+
+    submittedEvent1->release();
+    submittedEvent2->release();
+}
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsNotCompletedWhenAsyncProcessingIsInterruptedThenUnreferenceAll) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context;
+    MockCommandQueue cmdQ(&context, device.get(), nullptr);
+    *cmdQ.getCommandStreamReceiver().getTagAddress() = 0u;
+
+    auto submittedEvent = new Event(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 1u);
+    submittedEvent->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(submittedEvent);
+    handler->process();
+    EXPECT_EQ(1u, handler->submittedEventsCount);
+    EXPECT_EQ(1u, handler->submittedEvents.size());
+    EXPECT_EQ(3, submittedEvent->getRefInternalCount());
+
+    handler->allowAsyncProcess.store(false);
+    MockHandler::asyncProcess(handler.get());
+    EXPECT_EQ(0u, handler->submittedEventsCount);
+    EXPECT_EQ(2, submittedEvent->getRefInternalCount());
+
+    *cmdQ.getCommandStreamReceiver().getTagAddress() = 1u;
+    submittedEvent->updateExecutionStatus();
+    EXPECT_EQ(1, counter);
+    submittedEvent->release();
+}
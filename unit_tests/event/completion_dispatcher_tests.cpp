@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/event/completion_dispatcher.h"
+#include "runtime/event/event.h"
+#include "unit_tests/event/event_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_event.h"
+
+#include <memory>
+
+namespace {
+void CL_CALLBACK countCallback(cl_event event, cl_int status, void *userData) {
+    (*static_cast<uint32_t *>(userData))++;
+}
+} // namespace
+
+struct CompletionDispatcherTest : public EventTest {
+    void SetUp() override {
+        DebugManager.flags.EnableAsyncEventsHandler.set(false);
+        EventTest::SetUp();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(CompletionDispatcherTest, givenSubmittedEventWithoutCallbacksWhenStatusIsUpdatedThenItIsNotRegistered) {
+    *pTagMemory = 1;
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+
+    Event event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    event.updateExecutionStatus();
+
+    EXPECT_EQ(CL_SUBMITTED, event.peekExecutionStatus());
+    EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+}
+
+TEST_F(CompletionDispatcherTest, givenRegisteredEventsWhenTagIsDispatchedThenOnlyReachedEventsAreCompleted) {
+    *pTagMemory = 1;
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+    uint32_t callbacksCalled = 0;
+
+    Event event1(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    Event event2(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 6);
+    Event event3(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 10);
+    for (auto event : {&event1, &event2, &event3}) {
+        event->addCallback(countCallback, CL_COMPLETE, &callbacksCalled);
+        event->updateExecutionStatus();
+    }
+    EXPECT_EQ(3u, completionDispatcher.getRegisteredEventsCount());
+    EXPECT_EQ(5u, completionDispatcher.peekLowestTaskCount());
+
+    *pTagMemory = 6;
+    completionDispatcher.dispatch(6);
+
+    EXPECT_EQ(CL_COMPLETE, event1.peekExecutionStatus());
+    EXPECT_EQ(CL_COMPLETE, event2.peekExecutionStatus());
+    EXPECT_EQ(CL_SUBMITTED, event3.peekExecutionStatus());
+    EXPECT_EQ(2u, callbacksCalled);
+    EXPECT_EQ(1u, completionDispatcher.getRegisteredEventsCount());
+    EXPECT_EQ(10u, completionDispatcher.peekLowestTaskCount());
+
+    *pTagMemory = 10;
+    completionDispatcher.dispatch(10);
+    EXPECT_EQ(CL_COMPLETE, event3.peekExecutionStatus());
+    EXPECT_EQ(3u, callbacksCalled);
+    EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+}
+
+TEST_F(CompletionDispatcherTest, givenRegisteredEventWhenOtherEventObservesTagThenRegisteredEventIsCompleted) {
+    *pTagMemory = 1;
+    uint32_t callbacksCalled = 0;
+
+    Event registeredEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    registeredEvent.addCallback(countCallback, CL_COMPLETE, &callbacksCalled);
+    registeredEvent.updateExecutionStatus();
+    EXPECT_EQ(0u, callbacksCalled);
+
+    *pTagMemory = 8;
+    Event polledEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 8);
+    polledEvent.updateExecutionStatus();
+
+    EXPECT_EQ(CL_COMPLETE, polledEvent.peekExecutionStatus());
+    EXPECT_EQ(CL_COMPLETE, registeredEvent.peekExecutionStatus());
+    EXPECT_EQ(1u, callbacksCalled);
+}
+
+TEST_F(CompletionDispatcherTest, givenRegisteredEventWhenQueueWaitsForTaskCountThenRegisteredEventIsCompleted) {
+    *pTagMemory = 1;
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+    uint32_t callbacksCalled = 0;
+
+    Event event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    event.addCallback(countCallback, CL_COMPLETE, &callbacksCalled);
+    event.updateExecutionStatus();
+    EXPECT_EQ(1u, completionDispatcher.getRegisteredEventsCount());
+
+    *pTagMemory = 5;
+    pCmdQ->waitUntilComplete(5, 0, false);
+
+    EXPECT_EQ(CL_COMPLETE, event.peekExecutionStatus());
+    EXPECT_EQ(1u, callbacksCalled);
+    EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+}
+
+TEST_F(CompletionDispatcherTest, givenRegisteredEventCompletedBySetStatusWhenItIsDestroyedThenItIsUnregistered) {
+    *pTagMemory = 1;
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+    uint32_t callbacksCalled = 0;
+
+    auto event = std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    event->addCallback(countCallback, CL_COMPLETE, &callbacksCalled);
+    event->updateExecutionStatus();
+    event->setStatus(CL_COMPLETE);
+    EXPECT_EQ(1u, callbacksCalled);
+    EXPECT_EQ(1u, completionDispatcher.getRegisteredEventsCount());
+
+    event.reset();
+    EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+    EXPECT_EQ(UINT32_MAX, completionDispatcher.peekLowestTaskCount());
+
+    *pTagMemory = 5;
+    completionDispatcher.dispatch(5);
+    EXPECT_EQ(1u, callbacksCalled);
+}
+
+TEST_F(CompletionDispatcherTest, givenRegisteredEventWhenItIsDispatchedThenItIsNoLongerMarkedAsRegistered) {
+    *pTagMemory = 1;
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+    uint32_t callbacksCalled = 0;
+
+    auto event = std::make_unique<MockEvent<Event>>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    event->addCallback(countCallback, CL_COMPLETE, &callbacksCalled);
+    event->updateExecutionStatus();
+    EXPECT_TRUE(event->registeredForCompletion);
+
+    completionDispatcher.dispatch(5);
+    EXPECT_FALSE(event->registeredForCompletion);
+    EXPECT_EQ(1u, callbacksCalled);
+
+    event.reset();
+    EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+}
+
+TEST_F(CompletionDispatcherTest, givenUnregisteredEventBehindHeapFrontWhenTagIsDispatchedThenItIsSkipped) {
+    *pTagMemory = 1;
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+    uint32_t callbacksCalled = 0;
+
+    Event event1(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+    auto event2 = std::make_unique<Event>(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 6);
+    Event event3(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 7);
+    for (auto event : {&event1, event2.get(), &event3}) {
+        event->addCallback(countCallback, CL_COMPLETE, &callbacksCalled);
+        event->updateExecutionStatus();
+    }
+    EXPECT_EQ(3u, completionDispatcher.getRegisteredEventsCount());
+
+    event2.reset();
+    EXPECT_EQ(2u, completionDispatcher.getRegisteredEventsCount());
+    EXPECT_EQ(5u, completionDispatcher.peekLowestTaskCount());
+
+    *pTagMemory = 7;
+    completionDispatcher.dispatch(7);
+    EXPECT_EQ(CL_COMPLETE, event1.peekExecutionStatus());
+    EXPECT_EQ(CL_COMPLETE, event3.peekExecutionStatus());
+    EXPECT_EQ(2u, callbacksCalled);
+    EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+    EXPECT_EQ(UINT32_MAX, completionDispatcher.peekLowestTaskCount());
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/command_stream_receiver.h"
+#include "runtime/event/completion_dispatcher.h"
+#include "runtime/event/event.h"
+#include "unit_tests/event/event_fixture.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+
+#include <atomic>
+#include <thread>
+
+struct CompletionDispatcherMtTest : public EventTest {
+    void SetUp() override {
+        DebugManager.flags.EnableAsyncEventsHandler.set(false);
+        EventTest::SetUp();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(CompletionDispatcherMtTest, givenRegisteredEventWhenDispatchRacesWithLastReleaseThenEventIsNotAccessedAfterDestruction) {
+    auto &completionDispatcher = pCmdQ->getCommandStreamReceiver().getCompletionDispatcher();
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        *pTagMemory = 1;
+        // child event makes the parent registered without callbacks holding a reference to it
+        Event childEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, Event::eventNotReady, Event::eventNotReady);
+        auto event = new Event(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 3, 5);
+        event->addChild(childEvent);
+        event->updateExecutionStatus();
+        ASSERT_EQ(1u, completionDispatcher.getRegisteredEventsCount());
+
+        *pTagMemory = 5;
+        std::atomic<bool> started{false};
+        std::thread dispatchThread([&]() {
+            started = true;
+            completionDispatcher.dispatch(5);
+        });
+        while (!started)
+            ;
+        event->release();
+        dispatchThread.join();
+
+        EXPECT_EQ(0u, completionDispatcher.getRegisteredEventsCount());
+        EXPECT_EQ(UINT32_MAX, completionDispatcher.peekLowestTaskCount());
+    }
+}
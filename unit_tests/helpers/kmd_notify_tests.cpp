@@ -431,6 +431,105 @@ TEST_F(KmdNotifyTests, givenEnabledKmdNotifyMechanismWhenPowerSavingModeIsSetAnd
     EXPECT_EQ(0, timeout);
 }
 
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndNoWaitsRecordedWhenObtainingTimeoutParamsThenKmdNotifyTimeoutIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(localHwInfo.capabilityTable.kmdNotifyProperties));
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(150, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndShortWaitsRecordedWhenObtainingTimeoutParamsThenSpinTimeFollowsAverageWaitTime) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(1);
+    overrideKmdNotifyParams(true, 150, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(localHwInfo.capabilityTable.kmdNotifyProperties));
+    helper.recordWait(40, 40, false, false);
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(40 * KmdNotifyConstants::adaptiveWaitSpinMultiplier, timeout);
+
+    helper.recordWait(1000, 150, true, false);
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false);
+    EXPECT_EQ(150, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndDisabledKmdNotifyWhenWaitsWereRecordedThenTimeoutIsEnabled) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(1);
+    overrideKmdNotifyParams(false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(localHwInfo.capabilityTable.kmdNotifyProperties));
+    helper.recordWait(1, 1, false, false);
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(KmdNotifyConstants::adaptiveWaitMinimumSpinMicroseconds, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitEnabledAndLongWaitsRecordedWhenObtainingTimeoutParamsThenMinimumSpinTimeIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableAdaptiveWait.set(1);
+    overrideKmdNotifyParams(false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(localHwInfo.capabilityTable.kmdNotifyProperties));
+    helper.recordWait(KmdNotifyConstants::adaptiveWaitMaximumSpinMicroseconds + 1, 10, true, false);
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false);
+    EXPECT_TRUE(timeoutEnabled);
+    EXPECT_EQ(KmdNotifyConstants::adaptiveWaitMinimumSpinMicroseconds, timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveWaitDisabledWhenWaitsWereRecordedThenTimeoutParamsAreNotChanged) {
+    overrideKmdNotifyParams(false, 0, false, 0, false, 0);
+    MockKmdNotifyHelper helper(&(localHwInfo.capabilityTable.kmdNotifyProperties));
+    helper.recordWait(1, 1, false, false);
+
+    int64_t timeout = 0;
+    bool timeoutEnabled = helper.obtainTimeoutParams(timeout, false, 1, 2, 2, false);
+    EXPECT_FALSE(timeoutEnabled);
+}
+
+TEST_F(KmdNotifyTests, givenWaitsRecordedWhenGettingWaitStatisticsThenHistogramsAndAverageAreReturned) {
+    MockKmdNotifyHelper helper(&(localHwInfo.capabilityTable.kmdNotifyProperties));
+    EXPECT_EQ(-1, helper.getWaitStatistics().averageWaitMicroseconds);
+
+    helper.recordWait(0, 0, false, true);
+    helper.recordWait(80, 80, false, false);
+    helper.recordWait(160, 5, true, false);
+    helper.recordWait(int64_t(1) << 40, 5, true, false);
+
+    auto statistics = helper.getWaitStatistics();
+    EXPECT_EQ(4u, statistics.waits);
+    EXPECT_EQ(2u, statistics.sleeps);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[0]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[7]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[8]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[waitTimeHistogramBuckets - 1]);
+    EXPECT_EQ(1u, statistics.spinTimeHistogram[0]);
+    EXPECT_EQ(1u, statistics.spinTimeHistogram[7]);
+    EXPECT_EQ(2u, statistics.spinTimeHistogram[3]);
+    EXPECT_EQ(90 + ((int64_t(1) << 40) - 90) / KmdNotifyConstants::adaptiveWaitAverageDivisor, statistics.averageWaitMicroseconds);
+}
+
+HWTEST_F(KmdNotifyTests, givenReadyTaskCountWhenWaitUntilCompletionCalledThenWaitIsRecordedWithoutSleep) {
+    auto csr = createMockCsr<FamilyType>();
+    EXPECT_CALL(*csr, waitForCompletionWithTimeout(true, 2, taskCountToWait)).Times(1).WillOnce(::testing::Return(true));
+
+    cmdQ->waitUntilComplete(taskCountToWait, flushStampToWait, false);
+
+    auto statistics = mockKmdNotifyHelper->getWaitStatistics();
+    EXPECT_EQ(1u, statistics.waits);
+    EXPECT_EQ(0u, statistics.sleeps);
+    EXPECT_EQ(-1, statistics.averageWaitMicroseconds);
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/striped_hash.h"
+#include "runtime/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace {
+std::vector<char> createInput(size_t size) {
+    std::vector<char> input(size);
+    for (size_t i = 0; i < size; i++) {
+        input[i] = static_cast<char>(i * 31 + 7);
+    }
+    return input;
+}
+
+void initLanes(uint32_t *lanes) {
+    for (uint32_t lane = 0; lane < StripedHash::numLanes; lane++) {
+        lanes[lane] = lane;
+    }
+}
+} // namespace
+
+TEST(StripedHashTests, givenUnalignedDataWhenStripesAreUpdatedWithSse4ThenResultMatchesScalar) {
+    auto input = createInput(StripedHash::stripeSize * 64 + 1);
+    uint32_t scalarLanes[StripedHash::numLanes];
+    uint32_t sse4Lanes[StripedHash::numLanes];
+    initLanes(scalarLanes);
+    initLanes(sse4Lanes);
+
+    StripedHash::updateStripesScalar(scalarLanes, input.data() + 1, 64);
+    StripedHash::updateStripesSse4(sse4Lanes, input.data() + 1, 64);
+
+    for (size_t lane = 0; lane < StripedHash::numLanes; lane++) {
+        EXPECT_EQ(scalarLanes[lane], sse4Lanes[lane]);
+    }
+}
+
+TEST(StripedHashTests, givenUnalignedDataWhenStripesAreUpdatedWithAvx2ThenResultMatchesScalar) {
+    if (!CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        return;
+    }
+    auto input = createInput(StripedHash::stripeSize * 64 + 1);
+    uint32_t scalarLanes[StripedHash::numLanes];
+    uint32_t avx2Lanes[StripedHash::numLanes];
+    initLanes(scalarLanes);
+    initLanes(avx2Lanes);
+
+    StripedHash::updateStripesScalar(scalarLanes, input.data() + 1, 64);
+    StripedHash::updateStripesAvx2(avx2Lanes, input.data() + 1, 64);
+
+    for (size_t lane = 0; lane < StripedHash::numLanes; lane++) {
+        EXPECT_EQ(scalarLanes[lane], avx2Lanes[lane]);
+    }
+}
+
+TEST(StripedHashTests, givenInputSplitIntoChunksWhenHashIsCalculatedThenResultMatchesSingleUpdate) {
+    auto input = createInput(StripedHash::stripeSize * 10 + 5);
+    auto expected = StripedHash::hash(input.data(), input.size());
+
+    for (size_t chunkSize : {1u, 3u, 31u, 32u, 33u, 100u}) {
+        StripedHash hash;
+        for (size_t offset = 0; offset < input.size(); offset += chunkSize) {
+            hash.update(input.data() + offset, std::min(chunkSize, input.size() - offset));
+        }
+        EXPECT_EQ(expected, hash.finish()) << "chunk size: " << chunkSize;
+    }
+}
+
+TEST(StripedHashTests, givenInputsDifferingInSizeOrContentWhenHashIsCalculatedThenResultsDiffer) {
+    auto input = createInput(StripedHash::stripeSize * 2 + 1);
+    auto hash1 = StripedHash::hash(input.data(), input.size());
+    auto hash2 = StripedHash::hash(input.data(), input.size() - 1);
+    auto hash3 = StripedHash::hash(input.data(), StripedHash::stripeSize);
+    input[StripedHash::stripeSize] ^= 1;
+    auto hash4 = StripedHash::hash(input.data(), input.size());
+
+    EXPECT_NE(hash1, hash2);
+    EXPECT_NE(hash1, hash3);
+    EXPECT_NE(hash2, hash3);
+    EXPECT_NE(hash1, hash4);
+}
+
+TEST(StripedHashTests, givenNullptrWhenUpdateIsCalledThenHashIsNotChanged) {
+    StripedHash hash;
+    auto emptyHash = hash.finish();
+    hash.update(nullptr, 16);
+    EXPECT_EQ(emptyHash, hash.finish());
+
+    hash.update("data", 4);
+    auto dataHash = hash.finish();
+    hash.reset();
+    EXPECT_EQ(emptyHash, hash.finish());
+    EXPECT_NE(emptyHash, dataHash);
+}
@@ -154,3 +154,80 @@ TEST(KernelOperationDestruction, givenKernelOperationWhenItIsDestructedThenAllAl
     EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation2));
     EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation3));
 }
+
+TEST(KernelOperationPool, givenCommandComputeKernelWhenItIsDestructedThenKernelOperationIsReusedByQueue) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+    MockCommandQueue cmdQ(nullptr, device.get(), nullptr);
+    MockKernelWithInternals kernel(*device);
+    auto &allocationsForReuse = device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage()->getAllocationsForReuse();
+
+    auto kernelOperation = cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u);
+    auto dshAllocation = kernelOperation->dsh->getGraphicsAllocation();
+    auto cmdStreamAllocation = kernelOperation->commandStream->getGraphicsAllocation();
+    kernelOperation->dsh->getSpace(64u);
+    kernelOperation->commandStream->getSpace(64u);
+
+    {
+        std::vector<Surface *> surfaces;
+        CommandComputeKernel command(cmdQ, std::unique_ptr<KernelOperation>(kernelOperation), surfaces, false, false, false, nullptr, PreemptionMode::Disabled, kernel, 0);
+    }
+    EXPECT_EQ(1u, cmdQ.kernelOperationsPool.size());
+    EXPECT_TRUE(allocationsForReuse.peekIsEmpty());
+
+    auto reusedKernelOperation = std::unique_ptr<KernelOperation>(cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u));
+    EXPECT_EQ(kernelOperation, reusedKernelOperation.get());
+    EXPECT_TRUE(cmdQ.kernelOperationsPool.empty());
+    EXPECT_EQ(dshAllocation, reusedKernelOperation->dsh->getGraphicsAllocation());
+    EXPECT_EQ(cmdStreamAllocation, reusedKernelOperation->commandStream->getGraphicsAllocation());
+    EXPECT_EQ(0u, reusedKernelOperation->dsh->getUsed());
+    EXPECT_EQ(0u, reusedKernelOperation->commandStream->getUsed());
+}
+
+TEST(KernelOperationPool, givenPooledKernelOperationWithTooSmallHeapWhenItIsObtainedThenHeapAllocationIsReplaced) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+    MockCommandQueue cmdQ(nullptr, device.get(), nullptr);
+    auto &allocationsForReuse = device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage()->getAllocationsForReuse();
+
+    auto kernelOperation = std::unique_ptr<KernelOperation>(cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u));
+    auto dshAllocation = kernelOperation->dsh->getGraphicsAllocation();
+    auto requiredDshSize = kernelOperation->dsh->getMaxAvailableSpace() + 1;
+    cmdQ.releaseKernelOperation(std::move(kernelOperation));
+
+    kernelOperation.reset(cmdQ.obtainKernelOperation(4096u, 0u, requiredDshSize, 1u, 1u));
+    EXPECT_NE(dshAllocation, kernelOperation->dsh->getGraphicsAllocation());
+    EXPECT_LE(requiredDshSize, kernelOperation->dsh->getMaxAvailableSpace());
+    EXPECT_TRUE(allocationsForReuse.peekContains(*dshAllocation));
+}
+
+TEST(KernelOperationPool, givenPooledKernelOperationWithTaskCountNotCompletedWhenObtainingThenItIsNotReused) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+    MockCommandQueue cmdQ(nullptr, device.get(), nullptr);
+    auto tagAddress = cmdQ.getCommandStreamReceiver().getTagAddress();
+
+    auto kernelOperation = std::unique_ptr<KernelOperation>(cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u));
+    auto pooledKernelOperation = kernelOperation.get();
+    kernelOperation->taskCount = 5u;
+    cmdQ.releaseKernelOperation(std::move(kernelOperation));
+    EXPECT_EQ(1u, cmdQ.kernelOperationsPool.size());
+
+    *tagAddress = 4u;
+    kernelOperation.reset(cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u));
+    EXPECT_NE(pooledKernelOperation, kernelOperation.get());
+    EXPECT_EQ(1u, cmdQ.kernelOperationsPool.size());
+
+    *tagAddress = 5u;
+    kernelOperation.reset(cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u));
+    EXPECT_EQ(pooledKernelOperation, kernelOperation.get());
+    EXPECT_EQ(0u, kernelOperation->taskCount);
+    EXPECT_TRUE(cmdQ.kernelOperationsPool.empty());
+}
+
+TEST(KernelOperationPool, givenKernelOperationNotFreeingIshWhenItIsReleasedThenItIsNotPooled) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(platformDevices[0]));
+    MockCommandQueue cmdQ(nullptr, device.get(), nullptr);
+
+    auto kernelOperation = std::unique_ptr<KernelOperation>(cmdQ.obtainKernelOperation(4096u, 0u, 1u, 1u, 1u));
+    kernelOperation->doNotFreeISH = true;
+    cmdQ.releaseKernelOperation(std::move(kernelOperation));
+    EXPECT_TRUE(cmdQ.kernelOperationsPool.empty());
+}
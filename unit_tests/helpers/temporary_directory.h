@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "runtime/utilities/directory.h"
+
+#include <cstdio>
+#include <string>
+
+#ifdef _WIN32
+#include <direct.h>
+#define MakeTemporaryDirectory _mkdir
+#define RemoveTemporaryDirectory _rmdir
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#define MakeTemporaryDirectory(dir) mkdir(dir, 0777)
+#define RemoveTemporaryDirectory rmdir
+#endif
+
+// Creates a flat directory for files produced by a test and removes it with its content on destruction
+class TemporaryDirectory {
+  public:
+    TemporaryDirectory(const std::string &path) : path(path) {
+        MakeTemporaryDirectory(path.c_str());
+    }
+
+    ~TemporaryDirectory() {
+        for (auto &file : OCLRT::Directory::getFiles(path)) {
+            std::remove(file.c_str());
+        }
+        RemoveTemporaryDirectory(path.c_str());
+    }
+
+    const std::string &getPath() const { return path; }
+
+  protected:
+    std::string path;
+};
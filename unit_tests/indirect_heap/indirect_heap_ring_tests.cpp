@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/indirect_heap/indirect_heap.h"
+#include "runtime/indirect_heap/indirect_heap_ring.h"
+
+#include "gtest/gtest.h"
+
+using namespace OCLRT;
+
+struct IndirectHeapRingTest : public ::testing::Test {
+    void SetUp() override {
+        ring.reset(0u);
+    }
+
+    uint8_t buffer[1024];
+    IndirectHeap heap = {buffer, sizeof(buffer)};
+    IndirectHeapRing ring;
+};
+
+TEST_F(IndirectHeapRingTest, givenEnoughSpaceWhenReservingSpaceThenHeapIsNotWrapped) {
+    heap.getSpace(256);
+    EXPECT_TRUE(ring.reserveSpace(heap, 512, 0u));
+    EXPECT_EQ(256u, heap.getUsed());
+    EXPECT_EQ(0u, ring.peekLap());
+}
+
+TEST_F(IndirectHeapRingTest, givenHeapUsedByCompletedTaskWhenReservingSpaceThenHeapWrapsWithinSameBuffer) {
+    heap.getSpace(768);
+    ring.recordSubmission(heap, 1u, 0u);
+    EXPECT_EQ(1u, ring.getSegmentsCount());
+
+    EXPECT_TRUE(ring.reserveSpace(heap, 512, 1u));
+    EXPECT_EQ(0u, heap.getUsed());
+    EXPECT_EQ(buffer, heap.getCpuBase());
+    EXPECT_EQ(sizeof(buffer), heap.getMaxAvailableSpace());
+    EXPECT_EQ(1u, ring.peekLap());
+    EXPECT_EQ(0u, ring.getSegmentsCount());
+}
+
+TEST_F(IndirectHeapRingTest, givenHeapUsedByIncompleteTaskWhenReservingSpaceThenSpaceIsNotReserved) {
+    heap.getSpace(768);
+    ring.recordSubmission(heap, 1u, 0u);
+
+    EXPECT_FALSE(ring.reserveSpace(heap, 512, 0u));
+    EXPECT_EQ(768u, heap.getUsed());
+}
+
+TEST_F(IndirectHeapRingTest, givenNotSubmittedDataWhenReservingSpaceThenHeapIsNotWrapped) {
+    heap.getSpace(768);
+    EXPECT_FALSE(ring.reserveSpace(heap, 512, 0xFFFFFFFEu));
+    EXPECT_EQ(768u, heap.getUsed());
+}
+
+TEST_F(IndirectHeapRingTest, givenOnlyBeginningOfHeapCompletedWhenWrappingThenNewLapIsLimitedByOldestInFlightSegment) {
+    heap.getSpace(512);
+    ring.recordSubmission(heap, 1u, 0u);
+    heap.getSpace(384);
+    ring.recordSubmission(heap, 2u, 0u);
+
+    EXPECT_TRUE(ring.reserveSpace(heap, 256, 1u));
+    EXPECT_EQ(0u, heap.getUsed());
+
+    heap.getSpace(256);
+    EXPECT_TRUE(ring.reserveSpace(heap, 256, 1u));
+    EXPECT_FALSE(ring.reserveSpace(heap, 257, 1u));
+
+    EXPECT_TRUE(ring.reserveSpace(heap, 512, 2u));
+    EXPECT_EQ(256u, heap.getUsed());
+}
+
+TEST_F(IndirectHeapRingTest, givenReservedSizeWhenWrappingThenReservedSpaceIsKept) {
+    heap.getSpace(64);
+    ring.reset(64u);
+    heap.getSpace(768);
+    ring.recordSubmission(heap, 1u, 0u);
+
+    EXPECT_TRUE(ring.reserveSpace(heap, 512, 1u));
+    EXPECT_EQ(64u, heap.getUsed());
+}
+
+TEST_F(IndirectHeapRingTest, givenDataWrittenBeforeWrapWhenTaskIsSubmittedThenItProtectsTailOfPreviousLap) {
+    heap.getSpace(256);
+    ring.recordSubmission(heap, 1u, 0u);
+    heap.getSpace(640);
+
+    EXPECT_TRUE(ring.reserveSpace(heap, 256, 1u));
+    heap.getSpace(128);
+    ring.recordSubmission(heap, 2u, 1u);
+    EXPECT_EQ(2u, ring.getSegmentsCount());
+
+    EXPECT_FALSE(ring.reserveSpace(heap, 256, 1u));
+    EXPECT_TRUE(ring.reserveSpace(heap, 256, 2u));
+    EXPECT_EQ(128u, heap.getUsed());
+}
@@ -13,6 +13,9 @@
 #include "unit_tests/mocks/mock_allocation_properties.h"
 #include "unit_tests/utilities/containers_tests_helpers.h"
 
+#include <chrono>
+#include <thread>
+
 struct InternalAllocationStorageTest : public MemoryAllocatorFixture,
                                        public ::testing::Test {
     using MemoryAllocatorFixture::TearDown;
@@ -192,3 +195,80 @@ TEST_F(InternalAllocationStorageTest, givenAllocationWhenItIsPutOnReusableListWh
     auto internalAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::INTERNAL_HEAP);
     EXPECT_EQ(nullptr, internalAllocation);
 }
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsOfDifferentSizesWhenObtainingAllocationThenAllocationFromSmallestFittingSizeClassIsReturned) {
+    auto bigAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize64k, GraphicsAllocation::AllocationType::BUFFER});
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    *csr->getTagAddress() = 0u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(bigAllocation), REUSABLE_ALLOCATION, 0u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(smallAllocation), REUSABLE_ALLOCATION, 0u);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+
+    auto nextReusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(bigAllocation, nextReusedAllocation.get());
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    memoryManager->freeGraphicsMemory(nextReusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenBusyAllocationStoredBeforeCompletedOneWhenObtainingAllocationThenCompletedAllocationIsReturned) {
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    *csr->getTagAddress() = 2u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 2u);
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(completedAllocation, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER));
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+    storage->cleanAllocationList(5u, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+}
+
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsCleanedWhenObtainingAllocationThenOnlyRemainingAllocationCanBeObtained) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto allocation2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation2), REUSABLE_ALLOCATION, 3u);
+
+    storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*allocation2));
+
+    *csr->getTagAddress() = 3u;
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(allocation2, reusedAllocation.get());
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER));
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageTest, givenTrimTimeoutSetWhenReusableAllocationIsIdleLongerThanTimeoutThenItIsReleasedOnNextStore) {
+    DebugManagerStateRestore stateRestorer;
+    DebugManager.flags.ReusableAllocationsTrimTimeoutMs.set(1);
+
+    auto idleAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    auto newAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    *csr->getTagAddress() = 1u;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(idleAllocation), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 2u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(newAllocation), REUSABLE_ALLOCATION, 1u);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    EXPECT_FALSE(reusableAllocations.peekContains(*idleAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*busyAllocation));
+    EXPECT_TRUE(reusableAllocations.peekContains(*newAllocation));
+
+    storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
+}
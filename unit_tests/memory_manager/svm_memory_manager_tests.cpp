@@ -129,3 +129,39 @@ TEST_F(SVMMemoryAllocatorTest, whenReadOnlySvmAllocationCreatedThenGraphicsAlloc
 
     svmManager.freeSVMAlloc(svm);
 }
+
+TEST_F(SVMMemoryAllocatorTest, givenInteriorPointerLookedUpWhenSVMAllocationIsFreedThenLookupDoesNotReturnFreedAllocation) {
+    auto ptr = svmManager.createSVMAlloc(MemoryConstants::pageSize, false, false);
+    auto ptrInRange = ptrOffset(ptr, 64);
+    EXPECT_NE(nullptr, svmManager.getSVMAlloc(ptrInRange));
+    EXPECT_NE(nullptr, svmManager.getSVMAlloc(ptrInRange));
+
+    svmManager.freeSVMAlloc(ptr);
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(ptrInRange));
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenAllocationLookedUpInOneManagerWhenLookingUpSamePointerInOtherManagerThenNullptrIsReturned) {
+    MockSVMAllocsManager otherSvmManager(&memoryManager);
+    auto ptr = svmManager.createSVMAlloc(MemoryConstants::pageSize, false, false);
+    auto otherPtr = otherSvmManager.createSVMAlloc(MemoryConstants::pageSize, false, false);
+
+    EXPECT_NE(nullptr, svmManager.getSVMAlloc(ptr));
+    EXPECT_EQ(nullptr, otherSvmManager.getSVMAlloc(ptr));
+    EXPECT_NE(nullptr, otherSvmManager.getSVMAlloc(otherPtr));
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(otherPtr));
+
+    otherSvmManager.freeSVMAlloc(otherPtr);
+    svmManager.freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenOtherAllocationFreedWhenLookingUpInteriorPointerThenSameAllocationIsReturned) {
+    auto ptr = svmManager.createSVMAlloc(MemoryConstants::pageSize, false, false);
+    auto otherPtr = svmManager.createSVMAlloc(MemoryConstants::pageSize, false, false);
+    auto graphicsAllocation = svmManager.getSVMAlloc(ptrOffset(ptr, 4));
+
+    svmManager.freeSVMAlloc(otherPtr);
+    EXPECT_EQ(graphicsAllocation, svmManager.getSVMAlloc(ptrOffset(ptr, 8)));
+    EXPECT_EQ(nullptr, svmManager.getSVMAlloc(otherPtr));
+
+    svmManager.freeSVMAlloc(ptr);
+}
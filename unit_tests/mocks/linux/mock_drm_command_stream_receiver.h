@@ -9,6 +9,7 @@ template <typename GfxFamily>
 class TestedDrmCommandStreamReceiver : public DrmCommandStreamReceiver<GfxFamily> {
   public:
     using CommandStreamReceiver::commandStream;
+    using DrmCommandStreamReceiver<GfxFamily>::clearResidency;
     using DrmCommandStreamReceiver<GfxFamily>::residency;
 
     TestedDrmCommandStreamReceiver(gemCloseWorkerMode mode, ExecutionEnvironment &executionEnvironment)
@@ -26,6 +26,8 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
     using AsyncEventsHandler::openThread;
+    using AsyncEventsHandler::submittedEvents;
+    using AsyncEventsHandler::submittedEventsCount;
     using AsyncEventsHandler::thread;
 
     ~MockHandler() override {
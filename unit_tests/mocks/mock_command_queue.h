@@ -18,6 +18,7 @@ class MockCommandQueue : public CommandQueue {
   public:
     using CommandQueue::device;
     using CommandQueue::engine;
+    using CommandQueue::kernelOperationsPool;
     using CommandQueue::multiEngineQueue;
     using CommandQueue::obtainNewTimestampPacketNodes;
     using CommandQueue::requiresCacheFlushAfterWalker;
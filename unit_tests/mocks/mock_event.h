@@ -34,6 +34,7 @@ struct MockEvent : public BaseEventType {
     using Event::calcProfilingData;
     using Event::magic;
     using Event::queueTimeStamp;
+    using Event::registeredForCompletion;
     using Event::submitTimeStamp;
     using Event::timestampPacketContainer;
 };
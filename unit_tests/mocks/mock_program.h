@@ -24,6 +24,7 @@ class GraphicsAllocation;
 ////////////////////////////////////////////////////////////////////////////////
 class MockProgram : public Program {
   public:
+    using Program::buildKernelInfoIndex;
     using Program::createProgramFromBinary;
     using Program::getProgramCompilerVersion;
     using Program::isKernelDebugEnabled;
@@ -39,6 +40,7 @@ class MockProgram : public Program {
     using Program::irBinarySize;
     using Program::isProgramBinaryResolved;
     using Program::isSpirV;
+    using Program::kernelInfoIndex;
     using Program::programBinaryType;
 
     using Program::sourceCode;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/ptr_math.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+#include "unit_tests/mocks/mock_svm_manager.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+TEST(SvmAllocsManagerMt, givenConcurrentLookupsWhenAllocationsAreCreatedAndFreedThenLookupsReturnAllocationsContainingPointer) {
+    const size_t threadCount = 4;
+    const size_t stableAllocationsCount = 64;
+    const size_t iterationsCount = 2000;
+
+    ExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    MockSVMAllocsManager svmManager(&memoryManager);
+
+    std::vector<void *> stableAllocations;
+    for (size_t i = 0; i < stableAllocationsCount; i++) {
+        stableAllocations.push_back(svmManager.createSVMAlloc(MemoryConstants::pageSize, false, false));
+    }
+
+    std::atomic<bool> start{false};
+    std::atomic<size_t> failedLookups{0u};
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < threadCount; t++) {
+        readers.emplace_back([&, t] {
+            while (!start)
+                ;
+            for (size_t i = 0; i < iterationsCount; i++) {
+                auto ptr = ptrOffset(stableAllocations[(i + t) % stableAllocationsCount], (i * 8) % MemoryConstants::pageSize);
+                auto graphicsAllocation = svmManager.getSVMAlloc(ptr);
+                if (graphicsAllocation == nullptr ||
+                    ptr < graphicsAllocation->getUnderlyingBuffer() ||
+                    ptr >= ptrOffset(graphicsAllocation->getUnderlyingBuffer(), graphicsAllocation->getUnderlyingBufferSize())) {
+                    failedLookups++;
+                }
+            }
+        });
+    }
+
+    start = true;
+    for (size_t i = 0; i < iterationsCount / 10; i++) {
+        auto ptr = svmManager.createSVMAlloc(MemoryConstants::pageSize, false, false);
+        EXPECT_NE(nullptr, svmManager.getSVMAlloc(ptrOffset(ptr, 4)));
+        svmManager.freeSVMAlloc(ptr);
+        EXPECT_EQ(nullptr, svmManager.getSVMAlloc(ptrOffset(ptr, 4)));
+    }
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0u, failedLookups.load());
+
+    for (auto ptr : stableAllocations) {
+        svmManager.freeSVMAlloc(ptr);
+    }
+    EXPECT_EQ(0u, svmManager.getNumAllocs());
+}
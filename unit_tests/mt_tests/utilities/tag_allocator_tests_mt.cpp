@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/tag_allocator.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+struct MtTestTag {
+    void initialize() {}
+    static GraphicsAllocation::AllocationType getAllocationType() {
+        return GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER;
+    }
+    bool canBeReleased() const { return true; }
+    std::atomic<size_t> owner;
+};
+
+TEST(TagAllocatorMtTest, givenManyThreadsWhenTakingAndReturningTagsThenEachTagIsOwnedByOneThreadAtATime) {
+    MockMemoryManager memoryManager;
+    TagAllocator<MtTestTag> tagAllocator(&memoryManager, 64, 64);
+
+    const size_t threadsCount = std::max(4u, std::thread::hardware_concurrency());
+    const size_t iterations = 1000;
+    const size_t tagsPerIteration = 8;
+    std::atomic<uint32_t> ownershipViolations{0};
+
+    auto worker = [&](size_t threadId) {
+        std::vector<TagNode<MtTestTag> *> nodes;
+        for (size_t i = 0; i < iterations; i++) {
+            for (size_t j = 0; j < tagsPerIteration; j++) {
+                auto node = tagAllocator.getTag();
+                node->tagForCpuAccess->owner = threadId;
+                nodes.push_back(node);
+            }
+            for (auto node : nodes) {
+                if (node->tagForCpuAccess->owner != threadId) {
+                    ownershipViolations++;
+                }
+                tagAllocator.returnTag(node);
+            }
+            nodes.clear();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back(worker, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, ownershipViolations);
+    auto statistics = tagAllocator.getStatistics();
+    EXPECT_EQ(0u, statistics.usedTags);
+    EXPECT_EQ(0u, statistics.deferredTags);
+    EXPECT_NE(0u, statistics.magazineRefills);
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "offline_compiler/batch_compiler.h"
+#include "runtime/helpers/file_io.h"
+
+#include "environment.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <string>
+
+extern Environment *gEnvironment;
+
+namespace OCLRT {
+
+class BatchCompilerTests : public ::testing::Test {
+  public:
+    void SetUp() override {
+        writeDataToFile(inputsList, inputsListContent.c_str(), inputsListContent.size());
+    }
+
+    void TearDown() override {
+        std::remove(inputsList);
+    }
+
+    const char *inputsList = "batch_compiler_inputs.txt";
+    std::string inputsListContent = "# kernels to build\n"
+                                    "test_files/copybuffer.cl\r\n"
+                                    "\n"
+                                    "   \n";
+    int retVal = CL_SUCCESS;
+};
+
+TEST_F(BatchCompilerTests, givenInputsListWhenValidatingThenCommentsAndEmptyLinesAreSkipped) {
+    std::string devices = gEnvironment->devicePrefix + "," + gEnvironment->devicePrefix;
+    auto argv = {
+        "ocloc",
+        "batch",
+        "-inputs",
+        inputsList,
+        "-devices",
+        devices.c_str()};
+
+    BatchCompiler batch;
+    retVal = batch.validateInput(argv.size(), argv.begin());
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, batch.getInputs().size());
+    EXPECT_STREQ("test_files/copybuffer.cl", batch.getInputs()[0].c_str());
+    ASSERT_EQ(2u, batch.getDevices().size());
+    EXPECT_STREQ(gEnvironment->devicePrefix.c_str(), batch.getDevices()[1].c_str());
+}
+
+TEST_F(BatchCompilerTests, givenMissingDevicesWhenValidatingThenErrorIsReturned) {
+    auto argv = {
+        "ocloc",
+        "batch",
+        "-inputs",
+        inputsList};
+
+    BatchCompiler batch;
+    testing::internal::CaptureStdout();
+    retVal = batch.validateInput(argv.size(), argv.begin());
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+    EXPECT_THAT(output, ::testing::HasSubstr("Device names missing"));
+}
+
+TEST_F(BatchCompilerTests, givenMissingInputsListFileWhenValidatingThenErrorIsReturned) {
+    auto argv = {
+        "ocloc",
+        "batch",
+        "-inputs",
+        "missing_inputs.txt",
+        "-devices",
+        gEnvironment->devicePrefix.c_str()};
+
+    BatchCompiler batch;
+    testing::internal::CaptureStdout();
+    retVal = batch.validateInput(argv.size(), argv.begin());
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(INVALID_FILE, retVal);
+}
+
+TEST_F(BatchCompilerTests, givenInputsWithSameFileNameWhenValidatingThenErrorIsReturned) {
+    inputsListContent = "test_files/copybuffer.cl\n"
+                        "test_files/other/copybuffer.cl\n";
+    writeDataToFile(inputsList, inputsListContent.c_str(), inputsListContent.size());
+    auto argv = {
+        "ocloc",
+        "batch",
+        "-inputs",
+        inputsList,
+        "-devices",
+        gEnvironment->devicePrefix.c_str()};
+
+    BatchCompiler batch;
+    testing::internal::CaptureStdout();
+    retVal = batch.validateInput(argv.size(), argv.begin());
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+    EXPECT_THAT(output, ::testing::HasSubstr("same file name copybuffer"));
+}
+
+TEST_F(BatchCompilerTests, givenSingleFileOptionWhenValidatingThenErrorIsReturned) {
+    auto argv = {
+        "ocloc",
+        "batch",
+        "-inputs",
+        inputsList,
+        "-devices",
+        gEnvironment->devicePrefix.c_str(),
+        "-file",
+        "test_files/copybuffer.cl"};
+
+    BatchCompiler batch;
+    testing::internal::CaptureStdout();
+    retVal = batch.validateInput(argv.size(), argv.begin());
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(INVALID_COMMAND_LINE, retVal);
+}
+
+TEST_F(BatchCompilerTests, givenInputsAndDevicesWhenCompilingThenFatBinaryAndManifestAreCreated) {
+    auto argv = {
+        "ocloc",
+        "batch",
+        "-inputs",
+        inputsList,
+        "-devices",
+        gEnvironment->devicePrefix.c_str(),
+        "-threads",
+        "2",
+        "-out_dir",
+        "batch_compiler_test",
+        "-q"};
+
+    BatchCompiler batch;
+    retVal = batch.validateInput(argv.size(), argv.begin());
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = batch.compile();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    ASSERT_EQ(1u, batch.getResults().size());
+    EXPECT_EQ(CL_SUCCESS, batch.getResults()[0].retVal);
+    EXPECT_FALSE(batch.getResults()[0].elfBinary.empty());
+    EXPECT_STREQ(gEnvironment->familyNameWithType.c_str(), batch.getResults()[0].familyNameWithType.c_str());
+
+    EXPECT_TRUE(fileExists("batch_compiler_test/copybuffer.fatbin"));
+    ASSERT_TRUE(fileExists("batch_compiler_test/copybuffer.manifest.json"));
+
+    void *manifest = nullptr;
+    size_t manifestSize = loadDataFromFile("batch_compiler_test/copybuffer.manifest.json", manifest);
+    std::string manifestContent(static_cast<const char *>(manifest), manifestSize);
+    deleteDataReadFromFile(manifest);
+    EXPECT_THAT(manifestContent, ::testing::HasSubstr("\"input\": \"test_files/copybuffer.cl\""));
+    EXPECT_THAT(manifestContent, ::testing::HasSubstr("\"device\": \"" + gEnvironment->devicePrefix + "\""));
+    EXPECT_THAT(manifestContent, ::testing::HasSubstr("\"retVal\": 0"));
+}
+} // namespace OCLRT
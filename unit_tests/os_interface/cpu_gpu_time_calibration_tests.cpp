@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/cpu_gpu_time_calibration.h"
+#include "runtime/os_interface/os_time.h"
+#include "unit_tests/mocks/mock_ostime.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using namespace OCLRT;
+
+namespace {
+const double nominalNsPerTick = 83.333;
+
+class DriftingOSTime : public MockOSTime {
+  public:
+    bool getCpuGpuTime(TimeStampData *pGpuCpuTime) override {
+        pGpuCpuTime->GPUTimeStamp = gpuTicks;
+        pGpuCpuTime->CPUTimeinNS = cpuStartNs + static_cast<uint64_t>(std::llround(gpuTicks * actualNsPerTick));
+        return true;
+    }
+    uint64_t toActualCpuTime(uint64_t ticks) const {
+        return cpuStartNs + static_cast<uint64_t>(std::llround(ticks * actualNsPerTick));
+    }
+
+    uint64_t gpuTicks = 5000u;
+    uint64_t cpuStartNs = 1000000000u;
+    double actualNsPerTick = nominalNsPerTick * 1.0001;
+};
+} // namespace
+
+TEST(CpuGpuTimeCalibrationTest, givenNoSamplesWhenGettingModelThenFalseIsReturned) {
+    CpuGpuTimeCalibration calibration;
+    CpuGpuTimeModel model = {};
+    EXPECT_FALSE(calibration.getModel(nominalNsPerTick, model));
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenSamplesSpanningShortTimeWhenGettingModelThenNominalRateAndLatestSampleAreUsed) {
+    CpuGpuTimeCalibration calibration;
+    calibration.addSample({100u, 1000u});
+    calibration.addSample({200u, 9000u});
+
+    CpuGpuTimeModel model = {};
+    ASSERT_TRUE(calibration.getModel(nominalNsPerTick, model));
+    EXPECT_EQ(nominalNsPerTick, model.nsPerTick);
+    EXPECT_EQ(200u, model.referenceGpuTicks);
+    EXPECT_EQ(9000u, model.referenceCpuTime);
+    EXPECT_EQ(9000u + static_cast<uint64_t>(std::llround(10 * nominalNsPerTick)), model.toCpuTime(210u));
+    EXPECT_EQ(9000u - static_cast<uint64_t>(std::llround(10 * nominalNsPerTick)), model.toCpuTime(190u));
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenMostRecentSampleCloseToItsPredecessorWhenAddingSampleThenItIsReplaced) {
+    CpuGpuTimeCalibration calibration;
+    calibration.addSample({0u, 0u});
+    calibration.addSample({10u, 1000u});
+    calibration.addSample({20u, 2000u});
+    EXPECT_EQ(2u, calibration.getSamplesCount());
+
+    calibration.addSample({20u + CpuGpuTimeCalibration::minSampleIntervalNs, CpuGpuTimeCalibration::minSampleIntervalNs + 2000u});
+    EXPECT_EQ(2u, calibration.getSamplesCount());
+
+    calibration.addSample({30u + CpuGpuTimeCalibration::minSampleIntervalNs, CpuGpuTimeCalibration::minSampleIntervalNs + 3000u});
+    EXPECT_EQ(3u, calibration.getSamplesCount());
+
+    CpuGpuTimeModel model = {};
+    calibration.getModel(nominalNsPerTick, model);
+    EXPECT_EQ(30u + CpuGpuTimeCalibration::minSampleIntervalNs, model.referenceGpuTicks);
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenMoreSamplesThanLimitWhenAddingThenOldestSamplesAreDropped) {
+    CpuGpuTimeCalibration calibration;
+    for (uint64_t i = 0; i < CpuGpuTimeCalibration::maxSamples + 5; i++) {
+        calibration.addSample({i * 1000000u, i * CpuGpuTimeCalibration::minSampleIntervalNs});
+    }
+    EXPECT_EQ(CpuGpuTimeCalibration::maxSamples, calibration.getSamplesCount());
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenGpuTimestampGoingBackWhenAddingSampleThenPreviousSamplesAreDiscarded) {
+    CpuGpuTimeCalibration calibration;
+    calibration.addSample({1000u, 0u});
+    calibration.addSample({2000u, CpuGpuTimeCalibration::minSampleIntervalNs});
+    calibration.addSample({10u, 2 * CpuGpuTimeCalibration::minSampleIntervalNs});
+    EXPECT_EQ(1u, calibration.getSamplesCount());
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenSampleOlderThanMostRecentOneWhenAddingThenItIsIgnored) {
+    CpuGpuTimeCalibration calibration;
+    calibration.addSample({1000u, 5000u});
+    calibration.addSample({900u, 4000u});
+    EXPECT_EQ(1u, calibration.getSamplesCount());
+
+    CpuGpuTimeModel model = {};
+    calibration.getModel(nominalNsPerTick, model);
+    EXPECT_EQ(1000u, model.referenceGpuTicks);
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenSamplesWithRateFarFromNominalWhenGettingModelThenNominalRateIsUsed) {
+    CpuGpuTimeCalibration calibration;
+    for (uint64_t i = 0; i < CpuGpuTimeCalibration::maxSamples; i++) {
+        calibration.addSample({i * CpuGpuTimeCalibration::minSampleIntervalNs, i * CpuGpuTimeCalibration::minSampleIntervalNs});
+    }
+    CpuGpuTimeModel model = {};
+    ASSERT_TRUE(calibration.getModel(nominalNsPerTick, model));
+    EXPECT_EQ(nominalNsPerTick, model.nsPerTick);
+}
+
+TEST(CpuGpuTimeCalibrationTest, givenDriftingClocksSampledByOsTimeWhenGettingModelThenGpuTimestampsAreConvertedWithSubMicrosecondAccuracy) {
+    DriftingOSTime osTime;
+    TimeStampData timeStamp = {};
+    for (uint32_t i = 0; i < CpuGpuTimeCalibration::maxSamples; i++) {
+        EXPECT_TRUE(osTime.sampleCpuGpuTime(&timeStamp));
+        osTime.gpuTicks += 2 * static_cast<uint64_t>(CpuGpuTimeCalibration::minSampleIntervalNs / nominalNsPerTick);
+    }
+    EXPECT_EQ(CpuGpuTimeCalibration::maxSamples, osTime.getCpuGpuTimeCalibration().getSamplesCount());
+
+    CpuGpuTimeModel model = {};
+    ASSERT_TRUE(osTime.getCpuGpuTimeCalibration().getModel(nominalNsPerTick, model));
+    EXPECT_NEAR(osTime.actualNsPerTick, model.nsPerTick, 1e-6);
+
+    // one second after the last sample a model with nominal rate would be off by 100 microseconds
+    auto gpuTicks = osTime.gpuTicks + static_cast<uint64_t>(NSEC_PER_SEC / nominalNsPerTick);
+    auto expected = static_cast<double>(osTime.toActualCpuTime(gpuTicks));
+    EXPECT_NEAR(expected, static_cast<double>(model.toCpuTime(gpuTicks)), 10.0);
+}
@@ -10,6 +10,7 @@
 #include "runtime/helpers/file_io.h"
 #include "runtime/helpers/string_helpers.h"
 #include "runtime/os_interface/debug_settings_manager.h"
+#include "runtime/utilities/binary_log.h"
 #include "runtime/utilities/directory.h"
 
 #include <map>
@@ -94,9 +95,26 @@ class TestDebugSettingsManager : public DebugSettingsManager<DebugLevel> {
         return savedFiles[filename].str();
     }
 
+    std::unique_ptr<BinaryLogWriter> createBinaryLogWriter() override {
+        binaryLogStream = new std::stringstream;
+        return std::unique_ptr<BinaryLogWriter>(new BinaryLogWriter(std::unique_ptr<std::ostream>(binaryLogStream)));
+    }
+
+    std::string getDecodedBinaryLog() {
+        if (DebugSettingsManager<DebugLevel>::binaryLogWriter == nullptr) {
+            return "";
+        }
+        DebugSettingsManager<DebugLevel>::binaryLogWriter->flush();
+        std::stringstream decoded;
+        std::stringstream binaryLog(binaryLogStream->str());
+        BinaryLogDecoder::decode(binaryLog, decoded);
+        return decoded.str();
+    }
+
   protected:
     bool mockFileSystem = true;
     std::map<std::string, std::stringstream> savedFiles;
+    std::stringstream *binaryLogStream = nullptr;
 };
 
 template <bool DebugFunctionality>
@@ -90,6 +90,38 @@ TEST(DebugSettingsManager, WithoutDebugFunctionalityDoesNotCreateLogFile) {
     EXPECT_FALSE(debugManager.wasFileCreated(debugManager.getLogFileName()));
 }
 
+TEST(DebugSettingsManager, givenBinaryLoggingEnabledWhenApiCallsAndMessagesAreLoggedThenTheyAreStoredInBinaryLogInsteadOfLogFile) {
+    FullyEnabledTestDebugManager debugManager;
+    debugManager.flags.LogApiCalls.set(true);
+    debugManager.flags.EnableBinaryLogging.set(1);
+
+    debugManager.logApiCall("searchString", true, 0);
+    debugManager.logApiCall("searchString2", false, -5);
+    debugManager.logInputs("searchString3", "any");
+    debugManager.log(true, "searchString4", "with a message longer than a single binary log record");
+    debugManager.log(false, "searchString5");
+
+    EXPECT_FALSE(debugManager.wasFileCreated(debugManager.getLogFileName()));
+
+    auto decoded = debugManager.getDecodedBinaryLog();
+    EXPECT_NE(std::string::npos, decoded.find("Function Enter: searchString\n"));
+    EXPECT_NE(std::string::npos, decoded.find("Function Leave (-5): searchString2\n"));
+    EXPECT_NE(std::string::npos, decoded.find("searchString3: \tany\n"));
+    EXPECT_NE(std::string::npos, decoded.find("searchString4 with a message longer than a single binary log record"));
+    EXPECT_EQ(std::string::npos, decoded.find("searchString5"));
+}
+
+TEST(DebugSettingsManager, givenBinaryLoggingEnabledWithoutDebugFunctionalityWhenLoggingThenBinaryLogIsNotCreated) {
+    FullyDisabledTestDebugManager debugManager;
+    debugManager.flags.LogApiCalls.set(true);
+    debugManager.flags.EnableBinaryLogging.set(1);
+
+    debugManager.logApiCall("searchString", true, 0);
+    debugManager.log(true, "searchString2");
+
+    EXPECT_EQ("", debugManager.getDecodedBinaryLog());
+}
+
 TEST(DebugSettingsManager, WithIncorrectFilenameFileNotCreated) {
     FullyEnabledTestDebugManager debugManager;
     debugManager.useRealFiles(true);
@@ -686,6 +686,64 @@ TEST_F(DrmCommandStreamGemWorkerTests, givenTaskThatRequiresLargeResourceCountWh
     EXPECT_EQ(11u, execStorage.size());
 }
 
+TEST_F(DrmCommandStreamGemWorkerTests, givenUnchangedResidencyWhenFlushingAgainThenResidencyExecObjectsAreReused) {
+    auto graphicsAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto graphicsAllocation2 = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    csr->addBatchBufferEnd(cs, nullptr);
+    csr->alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
+
+    csr->makeResident(*graphicsAllocation);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    auto &execStorage = tCsr->getExecStorage();
+    auto boHandle = static_cast<DrmAllocation *>(graphicsAllocation)->getBO()->peekHandle();
+    EXPECT_EQ(static_cast<uint32_t>(boHandle), execStorage[0].handle);
+
+    // stored exec object is not refilled when the same residency is submitted again
+    execStorage[0].rsvd2 = 0xdead;
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(2u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(0xdeadu, execStorage[0].rsvd2);
+
+    csr->makeResident(*graphicsAllocation2);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(3u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(0u, execStorage[0].rsvd2);
+
+    mm->freeGraphicsMemory(commandBuffer);
+    mm->freeGraphicsMemory(graphicsAllocation);
+    mm->freeGraphicsMemory(graphicsAllocation2);
+    csr->getResidencyAllocations().clear();
+}
+
+TEST_F(DrmCommandStreamGemWorkerTests, givenBufferObjectReleasedSinceLastFlushWhenFlushingSameResidencyThenExecObjectsAreRefilled) {
+    auto graphicsAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    LinearStream cs(commandBuffer);
+    csr->addBatchBufferEnd(cs, nullptr);
+    csr->alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, cs.getUsed(), &cs};
+
+    csr->makeResident(*graphicsAllocation);
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    auto &execStorage = tCsr->getExecStorage();
+    execStorage[0].rsvd2 = 0xdead;
+
+    auto temporaryAllocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+    mm->freeGraphicsMemory(temporaryAllocation);
+
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+    EXPECT_EQ(0u, execStorage[0].rsvd2);
+
+    mm->freeGraphicsMemory(commandBuffer);
+    mm->freeGraphicsMemory(graphicsAllocation);
+    csr->getResidencyAllocations().clear();
+}
+
 TEST_F(DrmCommandStreamGemWorkerTests, givenGemCloseWorkerInactiveModeWhenMakeResidentIsCalledThenRefCountsAreNotUpdated) {
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize}));
 
@@ -14,6 +14,7 @@
 #include "runtime/os_interface/linux/drm_gem_close_worker.h"
 #include "runtime/os_interface/linux/drm_memory_manager.h"
 #include "test.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
 #include "unit_tests/os_interface/linux/device_command_stream_fixture.h"
 
 #include "drm/i915_drm.h"
@@ -190,3 +191,74 @@ TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTi
     worker->close(true);
     EXPECT_EQ(nullptr, worker->thread);
 }
+
+TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCreatedThenDefaultQueueLimitIsUsed) {
+    this->drmMock->gem_close_expected = 0;
+
+    DrmGemCloseWorker worker(*mm);
+    EXPECT_EQ(DrmGemCloseWorker::defaultQueueLimit, worker.getQueueLimit());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenOverrideGemCloseWorkerQueueLimitSetWhenWorkerIsCreatedThenQueueLimitIsOverridden) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.OverrideGemCloseWorkerQueueLimit.set(0);
+    this->drmMock->gem_close_expected = 0;
+
+    DrmGemCloseWorker worker(*mm);
+    EXPECT_EQ(0u, worker.getQueueLimit());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenBufferObjectsPushedWhenWorkerDrainsQueueThenStatisticsAreUpdated) {
+    this->drmMock->gem_close_expected = 3;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    worker->push(new BufferObjectWrapper(this->drmMock, 1));
+    worker->push(new BufferObjectWrapper(this->drmMock, 2));
+    worker->push(new BufferObjectWrapper(this->drmMock, 3));
+
+    auto statistics = worker->getStatistics();
+    while (statistics.closedBufferObjects < 3u && (deadCnt-- > 0)) {
+        pthread_yield();
+        statistics = worker->getStatistics();
+    }
+
+    EXPECT_EQ(0u, statistics.queueDepth);
+    EXPECT_LE(1u, statistics.maxQueueDepth);
+    EXPECT_EQ(3u, statistics.closedBufferObjects);
+    EXPECT_LE(1u, statistics.batches);
+    EXPECT_GE(3u, statistics.batches);
+    EXPECT_EQ(0u, statistics.backPressureWaits);
+    EXPECT_LE(statistics.maxLatencyNs, statistics.totalLatencyNs);
+
+    delete worker;
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenQueueLimitReachedWhenPushingBufferObjectThenPushWaitsUntilWorkerClosesBacklog) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.OverrideGemCloseWorkerQueueLimit.set(1);
+    this->drmMock->gem_close_expected = 2;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+
+    std::unique_lock<std::mutex> ioctlLock(this->drmMock->mutex);
+    worker->push(new BufferObjectWrapper(this->drmMock, 1));
+
+    std::atomic<bool> pushed{false};
+    std::thread pusher([&] {
+        worker->push(new BufferObjectWrapper(this->drmMock, 2));
+        pushed = true;
+    });
+
+    while (worker->getStatistics().backPressureWaits == 0u && (deadCnt-- > 0)) {
+        pthread_yield();
+    }
+    EXPECT_EQ(1u, worker->getStatistics().backPressureWaits);
+    EXPECT_FALSE(pushed);
+    EXPECT_EQ(0, this->drmMock->gem_close_cnt.load());
+
+    ioctlLock.unlock();
+    pusher.join();
+    EXPECT_TRUE(pushed);
+
+    delete worker;
+}
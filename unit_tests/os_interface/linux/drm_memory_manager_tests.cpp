@@ -1787,6 +1787,39 @@ TEST_F(DrmMemoryManagerTest, givenTwoGraphicsAllocationsThatShareTheSameBufferOb
     memoryManager->freeGraphicsMemory(graphicsAllocation2);
 }
 
+TEST_F(DrmMemoryManagerTest, givenSharedBufferObjectAlreadyInResidencyWhenResidencyIsClearedThenBoIsPassedToNextExecAgain) {
+    mock->ioctl_expected.primeFdToHandle = 2;
+    mock->ioctl_expected.gemClose = 1;
+    mock->ioctl_expected.gemWait = 2;
+
+    osHandle sharedHandle = 1u;
+    auto graphicsAllocation = memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, false);
+    auto graphicsAllocation2 = memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, false);
+
+    executionEnvironment->osInterface = std::make_unique<OSInterface>();
+    executionEnvironment->osInterface->get()->setDrm(mock);
+    auto testedCsr = new TestedDrmCommandStreamReceiver<DEFAULT_TEST_FAMILY_NAME>(*executionEnvironment);
+    device->resetCommandStreamReceiver(testedCsr);
+
+    testedCsr->makeResident(*graphicsAllocation);
+    testedCsr->makeResident(*graphicsAllocation2);
+
+    testedCsr->processResidency(testedCsr->getResidencyAllocations());
+    EXPECT_EQ(1u, testedCsr->residency.size());
+
+    testedCsr->processResidency(testedCsr->getResidencyAllocations());
+    EXPECT_EQ(1u, testedCsr->residency.size());
+
+    testedCsr->clearResidency();
+    EXPECT_EQ(0u, testedCsr->residency.size());
+
+    testedCsr->processResidency(testedCsr->getResidencyAllocations());
+    EXPECT_EQ(1u, testedCsr->residency.size());
+
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+    memoryManager->freeGraphicsMemory(graphicsAllocation2);
+}
+
 TEST_F(DrmMemoryManagerTest, givenTwoGraphicsAllocationsThatDoesnShareTheSameBufferObjectWhenTheyAreMadeResidentThenTwoBoIsPassedToExec) {
     mock->ioctl_expected.primeFdToHandle = 2;
     mock->ioctl_expected.gemClose = 2;
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/os_interface/os_file_lock.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+using namespace OCLRT;
+
+TEST(FileLockTest, givenFileNotLockedWhenLockingThenLockIsTaken) {
+    const char *fileName = "file_lock_test.lock";
+    auto lock = FileLock::tryLock(fileName);
+    EXPECT_NE(nullptr, lock);
+
+    lock.reset();
+    std::remove(fileName);
+}
+
+TEST(FileLockTest, givenFileLockedWhenLockingAgainThenNullptrIsReturnedUntilLockIsReleased) {
+    const char *fileName = "file_lock_held_test.lock";
+    auto lock = FileLock::tryLock(fileName);
+    ASSERT_NE(nullptr, lock);
+    EXPECT_EQ(nullptr, FileLock::tryLock(fileName));
+
+    lock.reset();
+    lock = FileLock::tryLock(fileName);
+    EXPECT_NE(nullptr, lock);
+
+    lock.reset();
+    std::remove(fileName);
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/file_io.h"
+#include "runtime/helpers/stdio.h"
+#include "runtime/os_interface/os_mapped_file.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace OCLRT;
+
+TEST(MappedFileTest, givenExistingFileWhenOpenedThenWholeContentIsMapped) {
+    const char *fileName = "mapped_file_test.bin";
+    const char content[] = "mapped file content";
+    ASSERT_EQ(sizeof(content), writeDataToFile(fileName, content, sizeof(content)));
+
+    auto mappedFile = MappedFile::open(fileName);
+    ASSERT_NE(nullptr, mappedFile);
+    EXPECT_EQ(sizeof(content), mappedFile->getSize());
+    EXPECT_EQ(0, memcmp(content, mappedFile->getData(), sizeof(content)));
+
+    mappedFile.reset();
+    std::remove(fileName);
+}
+
+TEST(MappedFileTest, givenEmptyFileWhenOpenedThenNullptrIsReturned) {
+    const char *fileName = "mapped_file_empty_test.bin";
+    FILE *file = nullptr;
+    fopen_s(&file, fileName, "wb");
+    ASSERT_NE(nullptr, file);
+    fclose(file);
+
+    EXPECT_EQ(nullptr, MappedFile::open(fileName));
+    std::remove(fileName);
+}
+
+TEST(MappedFileTest, givenMissingFileWhenOpenedThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, MappedFile::open("----do-not-exists----"));
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/compiler_interface/binary_cache.h"
+#include "runtime/execution_environment/execution_environment.h"
+#include "unit_tests/helpers/temporary_directory.h"
+#include "unit_tests/mocks/mock_program.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+const size_t programsCount = 64;
+const size_t programSize = 256 * 1024;
+
+class BinaryCacheInDirectory : public BinaryCache {
+  public:
+    BinaryCacheInDirectory(const std::string &cacheLocation) {
+        clCacheLocation = cacheLocation;
+    }
+};
+
+struct BinaryCachePerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+        cacheDirectory.reset(new TemporaryDirectory("binary_cache_perf_tests"));
+        cache.reset(new BinaryCacheInDirectory(cacheDirectory->getPath()));
+        binary.resize(programSize);
+        for (size_t i = 0; i < programsCount; i++) {
+            hashes.push_back("PERF_HASH_" + std::to_string(i));
+            cache->cacheBinary(hashes.back(), binary.data(), static_cast<uint32_t>(binary.size()));
+        }
+    }
+
+    void TearDown() override {
+        cache.reset();
+        cacheDirectory.reset();
+    }
+
+    // mimics program builds at startup: every program is looked up and, on a miss, stored
+    void buildPrograms(size_t first, size_t step) {
+        ExecutionEnvironment executionEnvironment;
+        MockProgram program(executionEnvironment);
+        for (size_t i = first; i < programsCount; i += step) {
+            if (!cache->loadCachedBinary(hashes[i], program)) {
+                cache->cacheBinary(hashes[i], binary.data(), static_cast<uint32_t>(binary.size()));
+            }
+        }
+    }
+
+    long long measureBuild(size_t threadsCount) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            std::vector<std::thread> threads;
+            Timer t;
+            t.start();
+            for (size_t thread = 0; thread < threadsCount; thread++) {
+                threads.emplace_back(&BinaryCachePerfTest::buildPrograms, this, thread, threadsCount);
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    std::unique_ptr<TemporaryDirectory> cacheDirectory;
+    std::unique_ptr<BinaryCache> cache;
+    std::vector<char> binary;
+    std::vector<std::string> hashes;
+};
+
+TEST_F(BinaryCachePerfTest, singleThreadedProgramBuildsFromCache) {
+    checkRatio("build", measureBuild(1));
+}
+
+TEST_F(BinaryCachePerfTest, multiThreadedProgramBuildsFromCache) {
+    auto threadsCount = std::max(2u, std::thread::hardware_concurrency());
+    checkRatio("build", measureBuild(threadsCount));
+}
+} // namespace ULT
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/hash.h"
+#include "runtime/helpers/striped_hash.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+const size_t programSize = 8 * 1024 * 1024;
+
+struct ProgramHashPerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+        program.resize(programSize);
+        for (size_t i = 0; i < programSize; i++) {
+            program[i] = static_cast<char>(i * 31 + 7);
+        }
+    }
+
+    template <typename HashT>
+    long long measureHash() {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            result ^= HashT::hash(program.data(), program.size());
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    std::vector<char> program;
+    uint64_t result = 0;
+};
+
+TEST_F(ProgramHashPerfTest, stripedHashOfLargeProgramIsNotSlowerThanJenkinsHash) {
+    auto jenkinsTime = measureHash<Hash>();
+    auto stripedTime = measureHash<StripedHash>();
+    checkRatio("jenkins", jenkinsTime);
+    checkRatio("striped", stripedTime);
+    EXPECT_LE(stripedTime, jenkinsTime);
+}
+} // namespace ULT
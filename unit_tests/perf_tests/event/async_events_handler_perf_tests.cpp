@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/event/async_events_handler.h"
+#include "runtime/event/event.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/mock_command_queue.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+struct AsyncEventsHandlerPerfTest : public ::testing::Test {
+    class SynchronousHandler : public AsyncEventsHandler {
+      public:
+        void openThread() override {}
+        Event *process() {
+            std::move(registerList.begin(), registerList.end(), std::back_inserter(list));
+            registerList.clear();
+            return processList();
+        }
+        bool isEmpty() const { return !hasEventsToProcess(); }
+    };
+
+    static void CL_CALLBACK callback(cl_event e, cl_int status, void *data) {
+        ++(*reinterpret_cast<uint32_t *>(data));
+    }
+
+    void SetUp() override {
+        setReferenceTime();
+        DebugManager.flags.EnableAsyncEventsHandler.set(false);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        cmdQ.reset(new MockCommandQueue(&context, device.get(), nullptr));
+    }
+
+    // outstanding callback events complete in task count order, a wake completes completionsPerWake of them
+    long long completeOutstandingEvents() {
+        auto tagAddress = cmdQ->getCommandStreamReceiver().getTagAddress();
+        *tagAddress = 0u;
+        uint32_t callbacksCalled = 0u;
+        SynchronousHandler handler;
+
+        std::vector<Event *> events;
+        for (uint32_t taskCount = 1; taskCount <= eventsCount; taskCount++) {
+            auto event = new Event(cmdQ.get(), CL_COMMAND_NDRANGE_KERNEL, 0, taskCount);
+            event->addCallback(callback, CL_COMPLETE, &callbacksCalled);
+            handler.registerEvent(event);
+            events.push_back(event);
+        }
+        handler.process();
+
+        Timer t;
+        t.start();
+        while (!handler.isEmpty()) {
+            *tagAddress += completionsPerWake;
+            handler.process();
+        }
+        t.end();
+
+        EXPECT_EQ(eventsCount, callbacksCalled);
+        for (auto event : events) {
+            event->release();
+        }
+        return t.get();
+    }
+
+    static const uint32_t eventsCount = 10000;
+    static const uint32_t completionsPerWake = 10;
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockDevice> device;
+    MockContext context;
+    std::unique_ptr<MockCommandQueue> cmdQ;
+};
+
+TEST_F(AsyncEventsHandlerPerfTest, completeTenThousandOutstandingCallbackEvents) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = completeOutstandingEvents();
+    }
+    checkRatio("completion", majorityVote(times[0], times[1], times[2]));
+}
+} // namespace ULT
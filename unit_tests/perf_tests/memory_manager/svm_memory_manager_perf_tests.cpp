@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/helpers/ptr_math.h"
+#include "unit_tests/mocks/mock_memory_manager.h"
+#include "unit_tests/mocks/mock_svm_manager.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+struct SvmLookupPerfTest : public ::testing::TestWithParam<size_t /*allocations count*/> {
+    void SetUp() override {
+        setReferenceTime();
+        memoryManager.reset(new MockMemoryManager(false, false, executionEnvironment));
+        svmManager.reset(new MockSVMAllocsManager(memoryManager.get()));
+
+        for (size_t i = 0; i < GetParam(); i++) {
+            allocations.push_back(svmManager->createSVMAlloc(MemoryConstants::pageSize, false, false));
+        }
+
+        // kernel arguments are mostly interior pointers spread over the whole allocation set
+        std::mt19937 generator(0x1234);
+        std::uniform_int_distribution<size_t> allocation(0, allocations.size() - 1);
+        std::uniform_int_distribution<size_t> offset(0, MemoryConstants::pageSize - 1);
+        for (size_t i = 0; i < lookupsCount; i++) {
+            lookups.push_back(ptrOffset(allocations[allocation(generator)], offset(generator)));
+        }
+    }
+
+    void TearDown() override {
+        for (auto ptr : allocations) {
+            svmManager->freeSVMAlloc(ptr);
+        }
+        svmManager.reset();
+        memoryManager.reset();
+    }
+
+    long long lookupAll(size_t threadsCount) {
+        std::vector<std::thread> threads;
+        Timer t;
+        t.start();
+        for (size_t i = 0; i < threadsCount; i++) {
+            threads.emplace_back([this] {
+                size_t found = 0;
+                for (auto ptr : lookups) {
+                    found += svmManager->getSVMAlloc(ptr) != nullptr;
+                }
+                EXPECT_EQ(lookups.size(), found);
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        t.end();
+        return t.get();
+    }
+
+    void runTest(size_t threadsCount) {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            times[i] = lookupAll(threadsCount);
+        }
+        checkRatio("lookups", majorityVote(times[0], times[1], times[2]));
+    }
+
+    static const size_t lookupsCount = 100000;
+
+    ExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    std::vector<void *> allocations;
+    std::vector<const void *> lookups;
+};
+
+TEST_P(SvmLookupPerfTest, randomInteriorPointerLookups) {
+    runTest(1);
+}
+
+TEST_P(SvmLookupPerfTest, randomInteriorPointerLookupsFromFourThreads) {
+    runTest(4);
+}
+
+INSTANTIATE_TEST_CASE_P(SvmLookupPerfTest,
+                        SvmLookupPerfTest,
+                        ::testing::Values(1000u, 10000u, 25000u));
+} // namespace ULT
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/command_stream/linear_stream.h"
+#include "runtime/os_interface/linux/drm_buffer_object.h"
+#include "runtime/os_interface/linux/drm_command_stream.h"
+#include "runtime/os_interface/linux/drm_memory_manager.h"
+#include "runtime/os_interface/linux/os_interface.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+#include "unit_tests/mocks/linux/mock_drm_allocation.h"
+#include "unit_tests/mocks/linux/mock_drm_command_stream_receiver.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "unit_tests/os_interface/linux/device_command_stream_fixture.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+class ReusableBufferObject : public BufferObject {
+  public:
+    ReusableBufferObject(Drm *drm, int handle) : BufferObject(drm, handle, false) {
+        this->isReused = true;
+        this->size = MemoryConstants::pageSize;
+    }
+};
+
+struct DrmResidencyPerfTest : public ::testing::TestWithParam<size_t> {
+    void SetUp() override {
+        setReferenceTime();
+
+        executionEnvironment = new ExecutionEnvironment;
+        executionEnvironment->incRefInternal();
+        executionEnvironment->setHwInfo(*platformDevices);
+        executionEnvironment->initGmm();
+        DebugManager.flags.EnableForcePin.set(false);
+
+        mock = std::make_unique<DrmMockCustom>();
+        executionEnvironment->osInterface = std::make_unique<OSInterface>();
+        executionEnvironment->osInterface->get()->setDrm(mock.get());
+
+        csr = new TestedDrmCommandStreamReceiver<DEFAULT_TEST_FAMILY_NAME>(*executionEnvironment);
+        memoryManager = new DrmMemoryManager(mock.get(), gemCloseWorkerInactive, false, false, true, *executionEnvironment);
+        executionEnvironment->memoryManager.reset(memoryManager);
+        device.reset(MockDevice::create<MockDevice>(platformDevices[0], executionEnvironment, 0u));
+        device->resetCommandStreamReceiver(csr);
+
+        // every buffer object is referenced by two allocations, e.g. a buffer shared between kernels
+        auto allocationsCount = GetParam();
+        for (size_t i = 0; i < allocationsCount / 2; i++) {
+            bufferObjects.push_back(std::make_unique<ReusableBufferObject>(mock.get(), static_cast<int>(i + 1)));
+        }
+        for (size_t i = 0; i < allocationsCount; i++) {
+            auto allocation = std::make_unique<MockDrmAllocation>(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::System4KBPages);
+            allocation->bo = bufferObjects[i % bufferObjects.size()].get();
+            residencyContainer.push_back(allocation.get());
+            allocations.push_back(std::move(allocation));
+        }
+
+        commandBuffer = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{MemoryConstants::pageSize});
+        commandStream = std::make_unique<LinearStream>(commandBuffer);
+        csr->addBatchBufferEnd(*commandStream, nullptr);
+        csr->alignToCacheLine(*commandStream);
+    }
+
+    void TearDown() override {
+        memoryManager->freeGraphicsMemory(commandBuffer);
+        device.reset();
+        executionEnvironment->decRefInternal();
+    }
+
+    long long measureFlush() {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            BatchBuffer batchBuffer{commandStream->getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, commandStream->getUsed(), commandStream.get()};
+            Timer t;
+            t.start();
+            csr->flush(batchBuffer, residencyContainer);
+            t.end();
+            times[i] = t.get();
+            EXPECT_EQ(0u, csr->getResidencyVector()->size());
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    DebugManagerStateRestore restorer;
+    ExecutionEnvironment *executionEnvironment = nullptr;
+    std::unique_ptr<DrmMockCustom> mock;
+    TestedDrmCommandStreamReceiver<DEFAULT_TEST_FAMILY_NAME> *csr = nullptr;
+    DrmMemoryManager *memoryManager = nullptr;
+    std::unique_ptr<MockDevice> device;
+
+    std::vector<std::unique_ptr<ReusableBufferObject>> bufferObjects;
+    std::vector<std::unique_ptr<MockDrmAllocation>> allocations;
+    ResidencyContainer residencyContainer;
+    GraphicsAllocation *commandBuffer = nullptr;
+    std::unique_ptr<LinearStream> commandStream;
+};
+
+TEST_P(DrmResidencyPerfTest, flushWithReusableBufferObjects) {
+    auto time = measureFlush();
+    checkRatio("flush", time);
+}
+
+INSTANTIATE_TEST_CASE_P(DrmResidencyPerfTest,
+                        DrmResidencyPerfTest,
+                        ::testing::Values(1000u, 2500u, 5000u, 10000u));
+} // namespace ULT
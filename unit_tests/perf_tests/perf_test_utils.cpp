@@ -21,6 +21,11 @@ const char *perfLogPath = "perf_logs/";
 // Global reference time
 long long refTime = 0;
 
+// multiplier of reference ratio that is compared (checked if less than) with current result
+const double ratioMultiplier = 1.5000;
+// ratio results that are not checked by EXPECT (very short time tests are not checked due to high fluctuations)
+const double ratioThreshold = 0.005;
+
 void setReferenceTime() {
     if (refTime == 0) {
         Timer t1, t2, t3;
@@ -134,3 +139,17 @@ bool updateTestRatio(uint64_t hash, double ratio) {
     }
     return false;
 }
+
+void checkRatio(const std::string &measurementName, long long time) {
+    auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    auto ratioName = std::string(testInfo->test_case_name()) + "." + testInfo->name() + "." + measurementName;
+    double previousRatio = -1.0;
+    uint64_t hash = Hash::hash(ratioName.c_str(), ratioName.size());
+    bool success = getTestRatio(hash, previousRatio);
+
+    double ratio = static_cast<double>(time) / static_cast<double>(refTime);
+    if (success && previousRatio > ratioThreshold) {
+        EXPECT_TRUE(isLowerThanReference(ratio, previousRatio, ratioMultiplier)) << "Current: " << ratio << " previous: " << previousRatio << "\n";
+    }
+    updateTestRatio(hash, ratio);
+}
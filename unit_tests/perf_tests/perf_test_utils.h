@@ -11,6 +11,7 @@
 #include "gtest/gtest.h"
 
 #include <stdint.h>
+#include <string>
 
 extern const char *perfLogPath;
 extern long long refTime;
@@ -25,6 +26,10 @@ bool isLowerThanReference(double data, double reference, double rangePercentage)
 
 bool updateTestRatio(uint64_t hash, double ratio);
 
+// compares ratio of time to reference time with the ratio stored by previous run of the same measurement and stores the new one,
+// measurements are identified by name of the current test and measurementName
+void checkRatio(const std::string &measurementName, long long time);
+
 template <typename T>
 T majorityVote(T time1, T time2, T time3) {
     T minTime1 = 0;
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/execution_environment/execution_environment.h"
+#include "unit_tests/mocks/mock_program.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+const size_t kernelsCount = 5000;
+
+struct KernelInfoLookupPerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+        program.reset(new MockProgram(executionEnvironment));
+        for (size_t i = 0; i < kernelsCount; i++) {
+            auto kernelInfo = new KernelInfo();
+            kernelInfo->name = "generated_kernel_" + std::to_string(i);
+            kernelNames.push_back(kernelInfo->name);
+            program->addKernelInfo(kernelInfo);
+        }
+    }
+
+    // mimics application startup: every kernel of the program is created by name
+    long long measureLookups() {
+        long long times[3] = {0, 0, 0};
+        for (int i = 0; i < 3; i++) {
+            Timer t;
+            t.start();
+            for (auto &kernelName : kernelNames) {
+                EXPECT_NE(nullptr, program->Program::getKernelInfo(kernelName.c_str()));
+            }
+            t.end();
+            times[i] = t.get();
+        }
+        return majorityVote(times[0], times[1], times[2]);
+    }
+
+    ExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockProgram> program;
+    std::vector<std::string> kernelNames;
+};
+
+TEST_F(KernelInfoLookupPerfTest, allKernelsOfLargeProgramAreLookedUpByNameWithoutIndex) {
+    checkRatio("linear", measureLookups());
+}
+
+TEST_F(KernelInfoLookupPerfTest, allKernelsOfLargeProgramAreLookedUpByNameWithIndex) {
+    program->buildKernelInfoIndex();
+    checkRatio("indexed", measureLookups());
+}
+} // namespace ULT
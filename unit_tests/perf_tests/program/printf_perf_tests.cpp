@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/program/print_formatter.h"
+#include "runtime/program/printf_handler.h"
+#include "unit_tests/mocks/mock_context.h"
+#include "unit_tests/mocks/mock_device.h"
+#include "unit_tests/mocks/mock_kernel.h"
+#include "unit_tests/mocks/mock_mdi.h"
+#include "unit_tests/mocks/mock_program.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+struct PrintfPerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        program = std::make_unique<MockProgram>(*device->getExecutionEnvironment(), &context, false);
+
+        printfSurface.DataParamOffset = 0;
+        printfSurface.DataParamSize = 8;
+        kernelInfo.patchInfo.pAllocateStatelessPrintfSurface = &printfSurface;
+
+        std::string formatString = R"(work item %d of %d, value: %f\n)";
+        std::unique_ptr<char[]> patchToken(new char[sizeof(SPatchString) + formatString.size() + 1]);
+        auto stringToken = reinterpret_cast<SPatchString *>(patchToken.get());
+        stringToken->Token = iOpenCL::PATCH_TOKEN_STRING;
+        stringToken->Size = static_cast<uint32_t>(sizeof(SPatchString) + formatString.size() + 1);
+        stringToken->Index = 0;
+        stringToken->StringSize = static_cast<uint32_t>(formatString.size() + 1);
+        memcpy(patchToken.get() + sizeof(SPatchString), formatString.c_str(), formatString.size() + 1);
+        kernelInfo.storePatchToken(stringToken);
+
+        kernel = std::make_unique<MockKernel>(program.get(), kernelInfo, *device);
+        kernel->setCrossThreadData(&crossThread, sizeof(crossThread));
+    }
+
+    // mimics what a kernel writes for a single printf call: string index followed by typed values
+    void writeKernelOutput(GraphicsAllocation &surface) {
+        auto data = reinterpret_cast<uint32_t *>(surface.getUnderlyingBuffer());
+        uint32_t offset = 1;
+        for (uint32_t workItem = 0; workItem < printsPerEnqueue; workItem++) {
+            data[offset++] = 0;
+            data[offset++] = static_cast<uint32_t>(PRINTF_DATA_TYPE::INT);
+            data[offset++] = workItem;
+            data[offset++] = static_cast<uint32_t>(PRINTF_DATA_TYPE::INT);
+            data[offset++] = printsPerEnqueue;
+            data[offset++] = static_cast<uint32_t>(PRINTF_DATA_TYPE::FLOAT);
+            float value = 0.5f * workItem;
+            memcpy(&data[offset++], &value, sizeof(value));
+        }
+        data[0] = offset * sizeof(uint32_t);
+    }
+
+    // every enqueue prepares a printf surface, then the output written by the kernel is read back and formatted
+    long long measureEnqueuesWithReadback() {
+        MockMultiDispatchInfo multiDispatchInfo(kernel.get());
+        size_t charactersPrinted = 0;
+        auto print = [&charactersPrinted](char *output) { charactersPrinted += strlen(output); };
+
+        Timer t;
+        t.start();
+        for (uint32_t enqueue = 0; enqueue < enqueuesCount; enqueue++) {
+            std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, *device));
+            printfHandler->prepareDispatch(multiDispatchInfo);
+            writeKernelOutput(*printfHandler->getSurface());
+
+            PrintFormatter printFormatter(*kernel, *printfHandler->getSurface());
+            printFormatter.printKernelOutput(print);
+        }
+        t.end();
+
+        EXPECT_NE(0u, charactersPrinted);
+        return t.get();
+    }
+
+    static const uint32_t enqueuesCount = 1000;
+    static const uint32_t printsPerEnqueue = 64;
+
+    MockContext context;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockProgram> program;
+    SPatchAllocateStatelessPrintfSurface printfSurface = {};
+    KernelInfo kernelInfo;
+    std::unique_ptr<MockKernel> kernel;
+    uint64_t crossThread[8];
+};
+
+TEST_F(PrintfPerfTest, printfKernelsAreEnqueuedAndTheirOutputIsReadBack) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = measureEnqueuesWithReadback();
+    }
+    checkRatio("enqueues", majorityVote(times[0], times[1], times[2]));
+}
+} // namespace ULT
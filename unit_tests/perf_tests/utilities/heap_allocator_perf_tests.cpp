@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/heap_allocator.h"
+#include "unit_tests/perf_tests/perf_test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace OCLRT;
+
+namespace ULT {
+
+struct HeapAllocatorPerfTest : public ::testing::Test {
+    void SetUp() override {
+        setReferenceTime();
+        generateTrace();
+    }
+
+    // Long running application pattern: a large live set of mixed sized allocations
+    // where random allocations are released and replaced, which leaves thousands
+    // of scattered free chunks on both freed lists.
+    void generateTrace() {
+        std::mt19937 generator(0x1234);
+        std::uniform_int_distribution<size_t> pages(1, 64);
+        std::uniform_int_distribution<size_t> slot(0, liveAllocations - 1);
+
+        for (size_t i = 0; i < liveAllocations; i++) {
+            trace.emplace_back(i, pages(generator) * MemoryConstants::pageSize);
+        }
+        for (size_t i = 0; i < replacements; i++) {
+            trace.emplace_back(slot(generator), pages(generator) * MemoryConstants::pageSize);
+        }
+    }
+
+    long long replayTrace() {
+        HeapAllocator heapAllocator(heapBase, heapSize, 16 * MemoryConstants::pageSize);
+        std::vector<std::pair<uint64_t, size_t>> live(liveAllocations, std::make_pair(0llu, 0u));
+
+        Timer t;
+        t.start();
+        for (auto &entry : trace) {
+            auto &allocation = live[entry.first];
+            heapAllocator.free(allocation.first, allocation.second);
+            allocation.second = entry.second;
+            allocation.first = heapAllocator.allocate(allocation.second);
+        }
+        t.end();
+
+        for (auto &allocation : live) {
+            heapAllocator.free(allocation.first, allocation.second);
+        }
+        EXPECT_EQ(0u, heapAllocator.getUsedSize());
+        return t.get();
+    }
+
+    static const uint64_t heapBase = 0x100000000llu;
+    static const uint64_t heapSize = 64llu * MemoryConstants::gigaByte;
+    static const size_t liveAllocations = 8192;
+    static const size_t replacements = 200000;
+
+    std::vector<std::pair<size_t, size_t>> trace;
+};
+
+TEST_F(HeapAllocatorPerfTest, fragmentedHeapAllocFreeTrace) {
+    long long times[3] = {0, 0, 0};
+    for (int i = 0; i < 3; i++) {
+        times[i] = replayTrace();
+    }
+    checkRatio("replay", majorityVote(times[0], times[1], times[2]));
+}
+} // namespace ULT
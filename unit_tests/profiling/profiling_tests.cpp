@@ -509,6 +509,50 @@ TEST(EventProfilingTest, givenRawTimestampsDebugModeWhenDataIsQueriedThenRawData
     event.timeStampNode = nullptr;
 }
 
+TEST(EventProfilingTest, givenCalibratedCpuGpuTimeWhenProfilingDataIsCalculatedThenDeviceTimeModelIsUsedInsteadOfQueueTimestamp) {
+    std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    device->setOSTime(new MyOSTime());
+    MockContext context;
+    cl_command_queue_properties props[5] = {0, 0, 0, 0, 0};
+    MockCommandQueue cmdQ(&context, device.get(), props);
+    cmdQ.setProfilingEnabled();
+    cmdQ.device = device.get();
+
+    auto &calibration = device->getOSTime()->getCpuGpuTimeCalibration();
+    calibration.addSample({1000u, 500000u});
+
+    HwTimeStamps timestamp;
+    timestamp.GlobalStartTS = 1100;
+    timestamp.ContextStartTS = 20;
+    timestamp.GlobalEndTS = 80;
+    timestamp.ContextEndTS = 56;
+    timestamp.GlobalCompleteTS = 0;
+    timestamp.ContextCompleteTS = 70;
+
+    MockTagNode<HwTimeStamps> timestampNode;
+    timestampNode.tagForCpuAccess = &timestamp;
+
+    MockEvent<Event> event(&cmdQ, CL_COMPLETE, 0, 0);
+    event.queueTimeStamp.CPUTimeinNS = 1;
+    event.queueTimeStamp.GPUTimeStamp = 2;
+    event.setCPUProfilingPath(false);
+    event.timeStampNode = &timestampNode;
+    event.calcProfilingData();
+
+    CpuGpuTimeModel model = {};
+    auto resolution = device->getDeviceInfo().profilingTimerResolution;
+    ASSERT_TRUE(calibration.getModel(resolution, model));
+
+    cl_ulong start, end;
+    clGetEventProfilingInfo(&event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, nullptr);
+    clGetEventProfilingInfo(&event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, nullptr);
+
+    EXPECT_EQ(model.toCpuTime(timestamp.GlobalStartTS), start);
+    EXPECT_EQ(start + static_cast<uint64_t>((timestamp.ContextEndTS - timestamp.ContextStartTS) * model.nsPerTick), end);
+    cmdQ.device = nullptr;
+    event.timeStampNode = nullptr;
+}
+
 struct ProfilingWithPerfCountersTests : public ProfilingTests,
                                         public PerformanceCountersFixture {
     void SetUp() override {
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/execution_environment/execution_environment.h"
+#include "runtime/helpers/ptr_math.h"
+#include "runtime/program/create.inl"
+#include "runtime/program/program.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace OCLRT;
+
+extern GFXCORE_FAMILY renderCoreFamily;
+
+namespace {
+template <typename TokenT>
+void pushBackToken(std::vector<char> &container, const TokenT &token) {
+    container.insert(container.end(), reinterpret_cast<const char *>(&token), reinterpret_cast<const char *>(&token) + sizeof(token));
+}
+
+std::vector<char> createBinaryWithKernels(uint32_t numKernels, uint32_t invalidKernel = UINT32_MAX) {
+    std::vector<char> binary;
+
+    iOpenCL::SProgramBinaryHeader progBinHeader = {};
+    progBinHeader.Magic = iOpenCL::MAGIC_CL;
+    progBinHeader.Version = iOpenCL::CURRENT_ICBE_VERSION;
+    progBinHeader.Device = renderCoreFamily;
+    progBinHeader.GPUPointerSizeInBytes = 8;
+    progBinHeader.NumberOfKernels = numKernels;
+    pushBackToken(binary, progBinHeader);
+
+    for (uint32_t i = 0; i < numKernels; i++) {
+        std::string kernelName = "kernel_" + std::to_string(i);
+        while (kernelName.size() % 4 != 0) {
+            kernelName.push_back('\0');
+        }
+        iOpenCL::SKernelBinaryHeaderCommon kernBinHeader = {};
+        kernBinHeader.KernelNameSize = static_cast<uint32_t>(kernelName.size());
+        if (i == invalidKernel) {
+            kernBinHeader.PatchListSize = static_cast<uint32_t>(sizeof(iOpenCL::SPatchItemHeader));
+        }
+        pushBackToken(binary, kernBinHeader);
+        binary.insert(binary.end(), kernelName.begin(), kernelName.end());
+
+        if (i == invalidKernel) {
+            iOpenCL::SPatchItemHeader unhandledToken = {};
+            unhandledToken.Size = static_cast<uint32_t>(sizeof(iOpenCL::SPatchItemHeader));
+            unhandledToken.Token = static_cast<uint32_t>(iOpenCL::NUM_PATCH_TOKENS);
+            pushBackToken(binary, unhandledToken);
+        }
+    }
+    return binary;
+}
+
+struct ParallelParsingProgram : public Program {
+    using Program::genBinary;
+    using Program::getKernelParsingThreadsCount;
+    using Program::minKernelsPerParsingThread;
+    using Program::Program;
+};
+
+std::unique_ptr<ParallelParsingProgram> createProgram(ExecutionEnvironment &executionEnvironment, const std::vector<char> &binary) {
+    cl_int retVal = CL_INVALID_BINARY;
+    std::unique_ptr<ParallelParsingProgram> program(Program::createFromGenBinary<ParallelParsingProgram>(executionEnvironment, nullptr, binary.data(),
+                                                                                                          binary.size(), false, &retVal));
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    return program;
+}
+} // namespace
+
+TEST(ParallelKernelParsingTest, givenParsingThreadsForcedWhenThreadsCountIsQueriedThenItIsLimitedByKernelsCount) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelKernelParsingThreads.set(4);
+
+    EXPECT_EQ(1u, ParallelParsingProgram::getKernelParsingThreadsCount(1));
+    EXPECT_EQ(2u, ParallelParsingProgram::getKernelParsingThreadsCount(2 * ParallelParsingProgram::minKernelsPerParsingThread));
+    EXPECT_EQ(4u, ParallelParsingProgram::getKernelParsingThreadsCount(100 * ParallelParsingProgram::minKernelsPerParsingThread));
+
+    DebugManager.flags.ParallelKernelParsingThreads.set(0);
+    EXPECT_EQ(1u, ParallelParsingProgram::getKernelParsingThreadsCount(100 * ParallelParsingProgram::minKernelsPerParsingThread));
+}
+
+TEST(ParallelKernelParsingTest, givenDefaultParsingThreadsWhenThreadsCountIsQueriedThenParsingIsSequential) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelKernelParsingThreads.set(-1);
+
+    EXPECT_EQ(1u, ParallelParsingProgram::getKernelParsingThreadsCount(100 * ParallelParsingProgram::minKernelsPerParsingThread));
+}
+
+TEST(ParallelKernelParsingTest, givenManyKernelsWhenBinaryIsProcessedInParallelThenKernelsAreStoredInBinaryOrder) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelKernelParsingThreads.set(4);
+    const uint32_t numKernels = 8 * ParallelParsingProgram::minKernelsPerParsingThread;
+
+    ExecutionEnvironment executionEnvironment;
+    auto binary = createBinaryWithKernels(numKernels);
+    auto program = createProgram(executionEnvironment, binary);
+
+    EXPECT_EQ(CL_SUCCESS, program->processGenBinary());
+    ASSERT_EQ(numKernels, program->getNumKernels());
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto kernelName = "kernel_" + std::to_string(i);
+        EXPECT_STREQ(kernelName.c_str(), program->getKernelInfo(i)->name.c_str());
+        EXPECT_EQ(program->getKernelInfo(i), program->getKernelInfo(kernelName.c_str()));
+    }
+}
+
+TEST(ParallelKernelParsingTest, givenInvalidKernelWhenBinaryIsProcessedInParallelThenOnlyPrecedingKernelsAreStored) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelKernelParsingThreads.set(4);
+    const uint32_t numKernels = 8 * ParallelParsingProgram::minKernelsPerParsingThread;
+    const uint32_t invalidKernel = 20;
+
+    ExecutionEnvironment executionEnvironment;
+    auto binary = createBinaryWithKernels(numKernels, invalidKernel);
+    auto program = createProgram(executionEnvironment, binary);
+
+    EXPECT_EQ(CL_INVALID_KERNEL, program->processGenBinary());
+    EXPECT_EQ(invalidKernel, program->getNumKernels());
+}
+
+TEST(ParallelKernelParsingTest, givenKernelExceedingGenBinaryWhenBinaryIsProcessedInParallelThenNoKernelIsStored) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelKernelParsingThreads.set(4);
+    const uint32_t numKernels = 8 * ParallelParsingProgram::minKernelsPerParsingThread;
+
+    ExecutionEnvironment executionEnvironment;
+    auto binary = createBinaryWithKernels(numKernels);
+    binary.resize(binary.size() - 1);
+    auto program = createProgram(executionEnvironment, binary);
+
+    EXPECT_EQ(CL_INVALID_BINARY, program->processGenBinary());
+    EXPECT_EQ(0u, program->getNumKernels());
+}
+
+TEST(ParallelKernelParsingTest, givenSameBinaryWhenProcessedSequentiallyAndInParallelThenResultsAreEqual) {
+    DebugManagerStateRestore restorer;
+    const uint32_t numKernels = 8 * ParallelParsingProgram::minKernelsPerParsingThread;
+    ExecutionEnvironment executionEnvironment;
+    auto binary = createBinaryWithKernels(numKernels);
+
+    DebugManager.flags.ParallelKernelParsingThreads.set(1);
+    auto sequentialProgram = createProgram(executionEnvironment, binary);
+    EXPECT_EQ(CL_SUCCESS, sequentialProgram->processGenBinary());
+
+    DebugManager.flags.ParallelKernelParsingThreads.set(4);
+    auto parallelProgram = createProgram(executionEnvironment, binary);
+    EXPECT_EQ(CL_SUCCESS, parallelProgram->processGenBinary());
+
+    ASSERT_EQ(sequentialProgram->getNumKernels(), parallelProgram->getNumKernels());
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto sequentialInfo = sequentialProgram->getKernelInfo(i);
+        auto parallelInfo = parallelProgram->getKernelInfo(i);
+        EXPECT_EQ(sequentialInfo->name, parallelInfo->name);
+        EXPECT_EQ(ptrDiff(sequentialInfo->heapInfo.pBlob, sequentialProgram->genBinary), ptrDiff(parallelInfo->heapInfo.pBlob, parallelProgram->genBinary));
+        EXPECT_EQ(sequentialInfo->heapInfo.blobSize, parallelInfo->heapInfo.blobSize);
+        EXPECT_EQ(sequentialInfo->isValid, parallelInfo->isValid);
+    }
+}
@@ -5,7 +5,9 @@
  *
  */
 
+#include "runtime/os_interface/os_context.h"
 #include "runtime/program/printf_handler.h"
+#include "runtime/program/printf_surface_pool.h"
 #include "unit_tests/fixtures/device_fixture.h"
 #include "unit_tests/mocks/mock_context.h"
 #include "unit_tests/mocks/mock_device.h"
@@ -144,3 +146,73 @@ TEST(PrintfHandlerTest, givenMultiDispatchInfoWithMultipleKernelsWhenCreatingAnd
     printfHandler->prepareDispatch(multiDispatchInfo);
     EXPECT_NE(nullptr, printfHandler->getSurface());
 }
+
+struct PrintfHandlerSurfacePoolTest : public ::testing::Test {
+    void SetUp() override {
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+        program = std::make_unique<MockProgram>(*device->getExecutionEnvironment(), &context, false);
+        printfSurface.DataParamOffset = 0;
+        printfSurface.DataParamSize = 8;
+        kernelInfo.patchInfo.pAllocateStatelessPrintfSurface = &printfSurface;
+        kernel = std::make_unique<MockKernel>(program.get(), kernelInfo, *device);
+        kernel->setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+    }
+
+    std::unique_ptr<PrintfHandler> createPreparedHandler() {
+        MockMultiDispatchInfo multiDispatchInfo(kernel.get());
+        std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, *device));
+        printfHandler->prepareDispatch(multiDispatchInfo);
+        return printfHandler;
+    }
+
+    MockContext context;
+    std::unique_ptr<MockDevice> device;
+    std::unique_ptr<MockProgram> program;
+    SPatchAllocateStatelessPrintfSurface printfSurface = {};
+    KernelInfo kernelInfo;
+    std::unique_ptr<MockKernel> kernel;
+    uint64_t crossThread[8];
+};
+
+TEST_F(PrintfHandlerSurfacePoolTest, givenReleasedPrintfSurfaceNotUsedByGpuWhenNextHandlerIsPreparedThenSurfaceIsReusedWithResetHeader) {
+    auto printfHandler = createPreparedHandler();
+    auto surface = printfHandler->getSurface();
+    auto header = reinterpret_cast<uint32_t *>(surface->getUnderlyingBuffer());
+    *header = 100u;
+    printfHandler.reset();
+    EXPECT_EQ(1u, device->getPrintfSurfacePool()->getPooledSurfacesCount());
+
+    printfHandler = createPreparedHandler();
+    EXPECT_EQ(surface, printfHandler->getSurface());
+    EXPECT_EQ(static_cast<uint32_t>(sizeof(uint32_t)), *header);
+    EXPECT_EQ(0u, device->getPrintfSurfacePool()->getPooledSurfacesCount());
+}
+
+TEST_F(PrintfHandlerSurfacePoolTest, givenReleasedPrintfSurfaceStillUsedByGpuWhenNextHandlerIsPreparedThenNewSurfaceIsAllocated) {
+    auto &csr = device->getCommandStreamReceiver();
+    auto contextId = csr.getOsContext().getContextId();
+
+    *csr.getTagAddress() = 0u;
+
+    auto printfHandler = createPreparedHandler();
+    auto surface = printfHandler->getSurface();
+    surface->updateTaskCount(1u, contextId);
+    printfHandler.reset();
+
+    printfHandler = createPreparedHandler();
+    EXPECT_NE(surface, printfHandler->getSurface());
+    EXPECT_EQ(1u, device->getPrintfSurfacePool()->getPooledSurfacesCount());
+
+    *csr.getTagAddress() = 1u;
+    auto nextPrintfHandler = createPreparedHandler();
+    EXPECT_EQ(surface, nextPrintfHandler->getSurface());
+}
+
+TEST_F(PrintfHandlerSurfacePoolTest, givenMorePrintfSurfacesReleasedThanPoolCapacityWhenReleasingThenSurplusSurfacesAreFreed) {
+    std::vector<std::unique_ptr<PrintfHandler>> printfHandlers;
+    for (size_t i = 0; i < PrintfSurfacePool::maxPooledSurfaces + 1; i++) {
+        printfHandlers.push_back(createPreparedHandler());
+    }
+    printfHandlers.clear();
+    EXPECT_EQ(PrintfSurfacePool::maxPooledSurfaces, device->getPrintfSurfacePool()->getPooledSurfacesCount());
+}
@@ -822,6 +822,49 @@ TEST_F(PrintFormatterTest, GivenEmptyBufferWhenPrintingThenFailSafely) {
     EXPECT_STREQ("", actualOutput);
 }
 
+TEST_F(PrintFormatterTest, GivenPrintfFormatWhenStoredInKernelInfoThenItIsTokenizedOnce) {
+    auto stringIndex = injectFormatString(R"(value: %d\n)");
+
+    auto stringInfo = kernelInfo->queryPrintfStringInfo(stringIndex);
+    ASSERT_NE(nullptr, stringInfo);
+    ASSERT_EQ(3u, stringInfo->formatTokens.size());
+    EXPECT_EQ(PrintfFormatToken::Type::Literal, stringInfo->formatTokens[0].type);
+    EXPECT_STREQ("value: ", stringInfo->formatTokens[0].text.c_str());
+    EXPECT_EQ(PrintfFormatToken::Type::Conversion, stringInfo->formatTokens[1].type);
+    EXPECT_STREQ("%d", stringInfo->formatTokens[1].text.c_str());
+    EXPECT_EQ(PrintfFormatToken::Type::Literal, stringInfo->formatTokens[2].type);
+    EXPECT_STREQ("\n", stringInfo->formatTokens[2].text.c_str());
+}
+
+TEST_F(PrintFormatterTest, GivenPrintfFormatNotTokenizedInKernelInfoWhenPrintingThenOutputIsFormatted) {
+    char formatString[] = "%d and %d";
+    PrintfStringInfo printfStringInfo;
+    printfStringInfo.SizeInBytes = sizeof(formatString);
+    printfStringInfo.pStringData = new char[sizeof(formatString)];
+    memcpy_s(printfStringInfo.pStringData, sizeof(formatString), formatString, sizeof(formatString));
+    kernelInfo->patchInfo.stringDataMap.insert(std::make_pair(0u, printfStringInfo));
+
+    storeData(0);
+    injectValue(1);
+    injectValue(2);
+
+    char actualOutput[PrintFormatter::maxPrintfOutputLength];
+    printFormatter->printKernelOutput([&actualOutput](char *str) { strncpy_s(actualOutput, PrintFormatter::maxPrintfOutputLength, str, PrintFormatter::maxPrintfOutputLength); });
+
+    EXPECT_STREQ("1 and 2", actualOutput);
+}
+
+TEST_F(PrintFormatterTest, GivenPrintfFormatWithEscapedPercentFollowedByConversionCharacterWhenPrintingThenOnlyFollowingSpecifierConsumesValue) {
+    auto stringIndex = injectFormatString("%%d %d");
+    storeData(stringIndex);
+    injectValue(5);
+
+    char actualOutput[PrintFormatter::maxPrintfOutputLength];
+    printFormatter->printKernelOutput([&actualOutput](char *str) { strncpy_s(actualOutput, PrintFormatter::maxPrintfOutputLength, str, PrintFormatter::maxPrintfOutputLength); });
+
+    EXPECT_STREQ("%d 5", actualOutput);
+}
+
 TEST(printToSTDOUTTest, GivenStringWhenPrintingToSTDOUTThenExpectOutput) {
     testing::internal::CaptureStdout();
     printToSTDOUT("test");
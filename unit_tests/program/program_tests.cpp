@@ -2946,3 +2946,55 @@ TEST_F(ProgramTests, givenProgramWhenBuiltThenAdditionalOptionsAreApplied) {
     program.build(1, &device, nullptr, nullptr, nullptr, false);
     EXPECT_EQ(1u, program.applyAdditionalOptionsCalled);
 }
+
+TEST_F(ProgramTests, givenKernelInfoIndexWhenKernelInfoIsQueriedByNameThenIndexedKernelInfoIsReturned) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    for (auto name : {"kernel0", "kernel1", "kernel2"}) {
+        auto kernelInfo = new KernelInfo();
+        kernelInfo->name = name;
+        program.addKernelInfo(kernelInfo);
+    }
+    program.buildKernelInfoIndex();
+
+    EXPECT_EQ(3u, program.kernelInfoIndex.size());
+    EXPECT_EQ(program.getKernelInfoArray()[0], program.Program::getKernelInfo("kernel0"));
+    EXPECT_EQ(program.getKernelInfoArray()[2], program.Program::getKernelInfo("kernel2"));
+    EXPECT_EQ(nullptr, program.Program::getKernelInfo("kernel3"));
+    EXPECT_EQ(nullptr, program.Program::getKernelInfo(nullptr));
+}
+
+TEST_F(ProgramTests, givenOutdatedKernelInfoIndexWhenKernelInfoIsQueriedByNameThenKernelInfoFromArrayIsReturned) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    for (auto name : {"kernel0", "kernel1"}) {
+        auto kernelInfo = new KernelInfo();
+        kernelInfo->name = name;
+        program.addKernelInfo(kernelInfo);
+    }
+    program.buildKernelInfoIndex();
+
+    auto &kernelInfoArray = program.getKernelInfoArray();
+    std::swap(kernelInfoArray[0], kernelInfoArray[1]);
+    auto kernelInfo = new KernelInfo();
+    kernelInfo->name = "kernel2";
+    program.addKernelInfo(kernelInfo);
+
+    EXPECT_EQ(kernelInfoArray[1], program.Program::getKernelInfo("kernel0"));
+    EXPECT_EQ(kernelInfoArray[0], program.Program::getKernelInfo("kernel1"));
+    EXPECT_EQ(kernelInfo, program.Program::getKernelInfo("kernel2"));
+}
+
+TEST_F(ProgramTests, givenProgramWhenKernelInfoIsCleanedThenKernelInfoIndexIsCleared) {
+    ExecutionEnvironment executionEnvironment;
+    MockProgram program(executionEnvironment);
+    auto kernelInfo = new KernelInfo();
+    kernelInfo->name = "kernel0";
+    program.addKernelInfo(kernelInfo);
+    program.buildKernelInfoIndex();
+    EXPECT_EQ(1u, program.kernelInfoIndex.size());
+
+    program.cleanCurrentKernelInfo();
+    EXPECT_TRUE(program.kernelInfoIndex.empty());
+    EXPECT_EQ(nullptr, program.Program::getKernelInfo("kernel0"));
+}
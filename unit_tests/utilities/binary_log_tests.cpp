@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/binary_log.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+TEST(BinaryLogRingBufferTest, givenFullBufferWhenRecordIsPushedThenItIsDroppedAndCounted) {
+    BinaryLogRingBuffer buffer(2, 1);
+    BinaryLogRecord record = {};
+
+    EXPECT_TRUE(buffer.push(record));
+    EXPECT_TRUE(buffer.push(record));
+    EXPECT_FALSE(buffer.push(record));
+
+    std::vector<BinaryLogRecord> records;
+    EXPECT_EQ(2u, buffer.drain(records));
+    EXPECT_EQ(1u, buffer.takeDroppedCount());
+    EXPECT_EQ(0u, buffer.takeDroppedCount());
+
+    EXPECT_TRUE(buffer.push(record));
+    EXPECT_EQ(1u, buffer.drain(records));
+    EXPECT_EQ(3u, records.size());
+}
+
+TEST(BinaryLogWriterTest, givenLoggedRecordsWhenFlushedThenDecoderRestoresTextLog) {
+    auto stream = new std::stringstream;
+    std::string decodedLog;
+    {
+        BinaryLogWriter writer{std::unique_ptr<std::ostream>(stream)};
+        writer.logApiCall("clEnqueueNDRangeKernel", true, 0);
+        writer.logApiCall("clEnqueueNDRangeKernel", false, -30);
+        writer.logMessage("message long enough to be stored in more than one binary log record\n");
+        writer.flush();
+
+        std::stringstream binaryLog(stream->str());
+        std::stringstream decoded;
+        EXPECT_TRUE(BinaryLogDecoder::decode(binaryLog, decoded));
+        decodedLog = decoded.str();
+    }
+
+    auto enter = decodedLog.find("] Function Enter: clEnqueueNDRangeKernel\n");
+    auto leave = decodedLog.find("] Function Leave (-30): clEnqueueNDRangeKernel\n");
+    auto message = decodedLog.find("] message long enough to be stored in more than one binary log record\n");
+    ASSERT_NE(std::string::npos, enter);
+    ASSERT_NE(std::string::npos, leave);
+    ASSERT_NE(std::string::npos, message);
+    EXPECT_LT(enter, leave);
+    EXPECT_LT(leave, message);
+}
+
+TEST(BinaryLogWriterTest, givenRecordsFromDifferentThreadsThenEachThreadUsesOwnBuffer) {
+    BinaryLogWriter writer(std::unique_ptr<std::ostream>(new std::stringstream));
+    writer.logMessage("main\n");
+    writer.logMessage("main\n");
+    EXPECT_EQ(1u, writer.getThreadBuffersCount());
+
+    std::thread worker([&writer]() {
+        writer.logMessage("worker\n");
+    });
+    worker.join();
+    EXPECT_EQ(2u, writer.getThreadBuffersCount());
+}
+
+TEST(BinaryLogWriterTest, givenFullThreadBufferWhenFlushedThenDroppedRecordsAreReported) {
+    auto stream = new std::stringstream;
+    BinaryLogWriter writer(std::unique_ptr<std::ostream>(stream), 1);
+    for (int i = 0; i < 100; i++) {
+        writer.logApiCall("clFinish", true, 0);
+    }
+    writer.flush();
+
+    std::stringstream binaryLog(stream->str());
+    std::stringstream decoded;
+    EXPECT_TRUE(BinaryLogDecoder::decode(binaryLog, decoded));
+    EXPECT_NE(std::string::npos, decoded.str().find(" records dropped\n"));
+}
+
+TEST(BinaryLogDecoderTest, givenStreamWithoutBinaryLogHeaderWhenDecodingThenFalseIsReturned) {
+    std::stringstream textLog("ThreadID: 1 Function Enter: clFinish\n");
+    std::stringstream decoded;
+    EXPECT_FALSE(BinaryLogDecoder::decode(textLog, decoded));
+}
@@ -27,16 +27,14 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     uint64_t getRightBound() const { return this->pRightBound; }
     uint64_t getavailableSize() const { return this->availableSize; }
     size_t getThresholdSize() const { return this->sizeThreshold; }
-    using HeapAllocator::defragment;
 
-    uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &vec) {
+    uint64_t getFromFreedChunks(size_t size, FreeChunks &freedChunks) {
         size_t sizeOfFreedChunk;
-        return HeapAllocator::getFromFreedChunks(size, vec, sizeOfFreedChunk);
+        return HeapAllocator::getFromFreedChunks(size, freedChunks, sizeOfFreedChunk);
     }
-    void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &vec) { return HeapAllocator::storeInFreedChunks(ptr, size, vec); }
 
-    std::vector<HeapChunk> &getFreedChunksSmall() { return this->freedChunksSmall; };
-    std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
+    FreeChunks &getFreedChunksSmall() { return this->freedChunksSmall; };
+    FreeChunks &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
 };
@@ -81,10 +79,10 @@ TEST(HeapAllocatorTest, GivenExactSizeChunkInFreedChunksWhenGetIsCalledThenChunk
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreeChunks freedChunks;
     uint64_t ptrFreed = 0x101000llu;
     size_t sizeFreed = MemoryConstants::pageSize * 2;
-    freedChunks.emplace_back(ptrFreed, sizeFreed);
+    freedChunks.store(ptrFreed, sizeFreed);
 
     auto ptrReturned = heapAllocator->getFromFreedChunks(sizeFreed, freedChunks);
 
@@ -97,15 +95,15 @@ TEST(HeapAllocatorTest, GivenOnlySmallerSizeChunksInFreedChunksWhenGetIsCalledTh
     size_t size = 1024 * 4096;
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreeChunks freedChunks;
 
-    freedChunks.emplace_back(0x100000llu, 4096);
-    freedChunks.emplace_back(0x101000llu, 4096);
-    freedChunks.emplace_back(0x105000llu, 4096);
-    freedChunks.emplace_back(0x104000llu, 4096);
-    freedChunks.emplace_back(0x102000llu, 8192);
-    freedChunks.emplace_back(0x109000llu, 8192);
-    freedChunks.emplace_back(0x107000llu, 4096);
+    freedChunks.store(0x100000llu, 4096);
+    freedChunks.store(0x102000llu, 4096);
+    freedChunks.store(0x10e000llu, 4096);
+    freedChunks.store(0x104000llu, 8192);
+    freedChunks.store(0x109000llu, 8192);
+    freedChunks.store(0x107000llu, 4096);
+    freedChunks.store(0x10c000llu, 4096);
 
     EXPECT_EQ(7u, freedChunks.size());
 
@@ -122,21 +120,23 @@ TEST(HeapAllocatorTest, GivenOnlyBiggerSizeChunksInFreedChunksWhenGetIsCalledThe
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreeChunks freedChunks;
     uint64_t ptrExpected = 0llu;
 
+    // chunks are separated by one page so that they are not merged
     pUpperBound -= 4096;
-    freedChunks.emplace_back(pUpperBound, 4096);
+    freedChunks.store(pUpperBound, 4096);
+    pUpperBound -= 6 * 4096;
+    freedChunks.store(pUpperBound, 5 * 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
-    ptrExpected = pUpperBound;
+    freedChunks.store(pUpperBound, 4 * 4096);
 
+    pUpperBound -= 6 * 4096;
+    freedChunks.store(pUpperBound, 5 * 4096);
     pUpperBound -= 5 * 4096;
-    freedChunks.emplace_back(pUpperBound, 5 * 4096);
-    pUpperBound -= 4 * 4096;
-    freedChunks.emplace_back(pUpperBound, 4 * 4096);
+    freedChunks.store(pUpperBound, 4 * 4096);
+    // equally sized chunks are taken in address order
+    ptrExpected = pUpperBound;
 
     EXPECT_EQ(5u, freedChunks.size());
 
@@ -153,15 +153,15 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
 
-    std::vector<HeapChunk> freedChunks;
+    FreeChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t requestedSize = 3 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
-    pLowerBound += 9 * 4096;
-    freedChunks.emplace_back(pLowerBound, 7 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
+    pLowerBound += 10 * 4096;
+    freedChunks.store(pLowerBound, 7 * 4096);
 
     size_t deltaSize = 7 * 4096 - requestedSize;
     ptrExpected = pLowerBound + deltaSize;
@@ -173,30 +173,23 @@ TEST(HeapAllocatorTest, GivenOnlyMoreThanTwiceBiggerSizeChunksInFreedChunksWhenG
     EXPECT_EQ(ptrExpected, ptrReturned);
     EXPECT_EQ(3u, freedChunks.size());
 
-    EXPECT_EQ(pLowerBound, freedChunks[2].ptr);
-    EXPECT_EQ(deltaSize, freedChunks[2].size);
+    EXPECT_EQ(deltaSize, freedChunks.getChunkSize(pLowerBound));
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
+    uint64_t pLowerBound = 0x100000llu;
 
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
-
-    std::vector<HeapChunk> freedChunks;
+    FreeChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
     pLowerBound += 9 * 4096;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
-
+    EXPECT_EQ(expectedSize, freedChunks.getChunkSize(ptrExpected));
     EXPECT_EQ(2u, freedChunks.size());
 
     auto ptrToStore = pLowerBound;
@@ -204,26 +197,20 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToLeftBoundaryOfIncomingChunkWhe
 
     expectedSize += sizeToStore;
 
-    heapAllocator->storeInFreedChunks(ptrToStore, sizeToStore, freedChunks);
+    freedChunks.store(ptrToStore, sizeToStore);
 
     EXPECT_EQ(2u, freedChunks.size());
-
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    EXPECT_EQ(expectedSize, freedChunks.getChunkSize(ptrExpected));
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWhenStoreIsCalledThenChunkIsMerged) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
+    uint64_t pLowerBound = 0x100000llu;
 
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
-
-    std::vector<HeapChunk> freedChunks;
+    FreeChunks freedChunks;
     uint64_t ptrExpected = 0llu;
     size_t expectedSize = 9 * 4096;
 
-    freedChunks.emplace_back(pLowerBound, 4096);
+    freedChunks.store(pLowerBound, 4096);
     pLowerBound += 4096;
     pLowerBound += 4096; // space between stored chunk and chunk to store
 
@@ -231,37 +218,44 @@ TEST(HeapAllocatorTest, GivenStoredChunkAdjacentToRightBoundaryOfIncomingChunkWh
     size_t sizeToStore = 2 * 4096;
     pLowerBound += sizeToStore;
 
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 9 * 4096);
     ptrExpected = pLowerBound;
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
-
+    EXPECT_EQ(expectedSize, freedChunks.getChunkSize(ptrExpected));
     EXPECT_EQ(2u, freedChunks.size());
 
     expectedSize += sizeToStore;
     ptrExpected = ptrToStore;
 
-    heapAllocator->storeInFreedChunks(ptrToStore, sizeToStore, freedChunks);
+    freedChunks.store(ptrToStore, sizeToStore);
+
+    EXPECT_EQ(2u, freedChunks.size());
+    EXPECT_EQ(expectedSize, freedChunks.getChunkSize(ptrExpected));
+    EXPECT_EQ(0u, freedChunks.getChunkSize(pLowerBound));
+}
+
+TEST(HeapAllocatorTest, GivenStoredChunksAdjacentToBothBoundariesOfIncomingChunkWhenStoreIsCalledThenAllChunksAreMerged) {
+    uint64_t pLowerBound = 0x100000llu;
 
+    FreeChunks freedChunks;
+    freedChunks.store(pLowerBound, 4096);
+    freedChunks.store(pLowerBound + 3 * 4096, 9 * 4096);
     EXPECT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(ptrExpected, freedChunks[1].ptr);
-    EXPECT_EQ(expectedSize, freedChunks[1].size);
+    freedChunks.store(pLowerBound + 4096, 2 * 4096);
+
+    EXPECT_EQ(1u, freedChunks.size());
+    EXPECT_EQ(12u * 4096, freedChunks.getChunkSize(pLowerBound));
 }
 
 TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCalledThenNewFreeChunkIsCreated) {
-    uint64_t ptrBase = 0x100000llu;
-    size_t size = 1024 * 4096;
-    auto pLowerBound = ptrBase;
+    uint64_t pLowerBound = 0x100000llu;
 
-    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, sizeThreshold);
+    FreeChunks freedChunks;
 
-    std::vector<HeapChunk> freedChunks;
-
-    freedChunks.emplace_back(pLowerBound, 4096);
-    pLowerBound += 4096;
-    freedChunks.emplace_back(pLowerBound, 9 * 4096);
+    freedChunks.store(pLowerBound, 4096);
+    pLowerBound += 2 * 4096;
+    freedChunks.store(pLowerBound, 9 * 4096);
     pLowerBound += 9 * 4096;
 
     pLowerBound += 9 * 4096;
@@ -271,12 +265,10 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
 
     EXPECT_EQ(2u, freedChunks.size());
 
-    heapAllocator->storeInFreedChunks(ptrToStore, sizeToStore, freedChunks);
+    freedChunks.store(ptrToStore, sizeToStore);
 
     EXPECT_EQ(3u, freedChunks.size());
-
-    EXPECT_EQ(ptrToStore, freedChunks[2].ptr);
-    EXPECT_EQ(sizeToStore, freedChunks[2].size);
+    EXPECT_EQ(sizeToStore, freedChunks.getChunkSize(ptrToStore));
 }
 
 TEST(HeapAllocatorTest, AllocateReturnsPointerAndAddsEntryToMap) {
@@ -733,7 +725,7 @@ TEST(HeapAllocatorTest, AllocationsDoNotOverlap) {
     alignedFree(pBasePtr);
 }
 
-TEST(HeapAllocatorTest, defragmentBig) {
+TEST(HeapAllocatorTest, GivenBigChunksFreedOutOfOrderWhenFreedThenAdjacentChunksAreMergedImmediately) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -745,7 +737,7 @@ TEST(HeapAllocatorTest, defragmentBig) {
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksBig();
+    FreeChunks &freedChunks = heapAllocator->getFreedChunksBig();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -772,24 +764,13 @@ TEST(HeapAllocatorTest, defragmentBig) {
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ(basePtr, freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
-
-    EXPECT_EQ((basePtr + 6 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ(3 * allocSize, freedChunks.getChunkSize(basePtr));
+    EXPECT_EQ(5 * allocSize, freedChunks.getChunkSize(basePtr + 6 * allocSize));
 }
 
-TEST(HeapAllocatorTest, defragmentSmall) {
+TEST(HeapAllocatorTest, GivenSmallChunksFreedOutOfOrderWhenFreedThenAdjacentChunksAreMergedImmediately) {
     uint64_t ptrBase = 0x100000llu;
     uint64_t basePtr = 0x100000;
 
@@ -802,7 +783,7 @@ TEST(HeapAllocatorTest, defragmentSmall) {
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreeChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     // 0, 1, 2 - can be merged to one
     // 6,7,8,10 - can be merged to one
@@ -829,21 +810,10 @@ TEST(HeapAllocatorTest, defragmentSmall) {
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
-
-    heapAllocator->defragment();
-
     ASSERT_EQ(2u, freedChunks.size());
 
-    EXPECT_EQ((upperLimitPtr - 3 * allocSize), freedChunks[0].ptr);
-    EXPECT_EQ(3 * allocSize, freedChunks[0].size);
-
-    EXPECT_EQ((upperLimitPtr - 10 * allocSize), freedChunks[1].ptr);
-    EXPECT_EQ(5 * allocSize, freedChunks[1].size);
+    EXPECT_EQ(3 * allocSize, freedChunks.getChunkSize(upperLimitPtr - 3 * allocSize));
+    EXPECT_EQ(5 * allocSize, freedChunks.getChunkSize(upperLimitPtr - 10 * allocSize));
 }
 
 TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastChunkFreedReturnsWholeSpaceToFreeRange) {
@@ -853,7 +823,7 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenFreedInTheSameOrderThenLastCh
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunks = heapAllocator->getFreedChunksSmall();
+    FreeChunks &freedChunks = heapAllocator->getFreedChunksSmall();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -889,8 +859,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallSp
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreeChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreeChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -950,8 +920,8 @@ TEST(HeapAllocatorTest, Given10SmallAllocationsWhenMergedToBigAllocatedAsSmallNo
 
     auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, threshold);
 
-    std::vector<HeapChunk> &freedChunksSmall = heapAllocator->getFreedChunksSmall();
-    std::vector<HeapChunk> &freedChunksBig = heapAllocator->getFreedChunksBig();
+    FreeChunks &freedChunksSmall = heapAllocator->getFreedChunksSmall();
+    FreeChunks &freedChunksBig = heapAllocator->getFreedChunksBig();
 
     uint64_t ptrs[10];
     size_t sizes[10];
@@ -36,6 +36,16 @@ TEST(RefCounter, givenReferenceTrackedObjectWhenDecAndReturnCurrentIsCalledThenM
     EXPECT_EQ(-1, rc.decAndReturnCurrent());
 }
 
+TEST(RefCounter, givenZeroCountWhenIncIfNotZeroIsCalledThenCountIsNotIncremented) {
+    RefCounter<> rc;
+    EXPECT_FALSE(rc.incIfNotZero());
+    EXPECT_TRUE(rc.peekIsZero());
+
+    rc.inc();
+    EXPECT_TRUE(rc.incIfNotZero());
+    EXPECT_EQ(2, rc.peek());
+}
+
 TEST(unique_ptr_if_unused, InitializedWithDefaultConstructorAtQueryReturnsNullptr) {
     unique_ptr_if_unused<int> uptr;
     ASSERT_EQ(nullptr, uptr.get());
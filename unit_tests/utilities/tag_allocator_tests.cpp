@@ -12,7 +12,9 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 using namespace OCLRT;
 
@@ -38,6 +40,9 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
     using TagAllocator<timeStamps>::populateFreeTags;
     using TagAllocator<timeStamps>::deferredTags;
     using TagAllocator<timeStamps>::releaseDeferredTags;
+    using TagAllocator<timeStamps>::freeTags;
+    using TagAllocator<timeStamps>::getMagazine;
+    using TagAllocator<timeStamps>::magazines;
 
     MockTagAllocator(MemoryManager *memMngr, size_t tagCount, size_t tagAlignment) : TagAllocator<timeStamps>(memMngr, tagCount, tagAlignment) {
     }
@@ -46,20 +51,33 @@ class MockTagAllocator : public TagAllocator<timeStamps> {
         return TagAllocator<timeStamps>::gfxAllocations[id];
     }
 
+    // next tag that will be moved from the shared pool to a magazine
     TagNode<timeStamps> *getFreeTagsHead() {
-        return TagAllocator<timeStamps>::freeTags.peekHead();
+        return freeTags.empty() ? nullptr : freeTags.back();
     }
 
-    TagNode<timeStamps> *getUsedTagsHead() {
-        return TagAllocator<timeStamps>::usedTags.peekHead();
+    size_t getFreeTagsCount() {
+        size_t count = freeTags.size();
+        for (auto &magazine : magazines) {
+            count += magazine.nodes.size();
+        }
+        return count;
     }
 
-    IDList<TagNode<timeStamps>> &getFreeTags() {
-        return TagAllocator<timeStamps>::freeTags;
+    bool isFreeTag(TagNode<timeStamps> *node) {
+        if (std::find(freeTags.begin(), freeTags.end(), node) != freeTags.end()) {
+            return true;
+        }
+        for (auto &magazine : magazines) {
+            if (std::find(magazine.nodes.begin(), magazine.nodes.end(), node) != magazine.nodes.end()) {
+                return true;
+            }
+        }
+        return false;
     }
 
-    IDList<TagNode<timeStamps>> &getUsedTags() {
-        return TagAllocator<timeStamps>::usedTags;
+    size_t getUsedTagsCount() {
+        return getStatistics().usedTags;
     }
 
     size_t getGraphicsAllocationsCount() {
@@ -78,7 +96,7 @@ TEST_F(TagAllocatorTest, Initialize) {
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
 
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 
     void *gfxMemory = tagAllocator.getGraphicsAllocation()->getUnderlyingBuffer();
     void *head = reinterpret_cast<void *>(tagAllocator.getFreeTagsHead()->tagForCpuAccess);
@@ -91,28 +109,19 @@ TEST_F(TagAllocatorTest, GetReturnTagCheckFreeAndUsedLists) {
 
     ASSERT_NE(nullptr, tagAllocator.getGraphicsAllocation());
     ASSERT_NE(nullptr, tagAllocator.getFreeTagsHead());
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 
     TagNode<timeStamps> *tagNode = tagAllocator.getTag();
 
     EXPECT_NE(nullptr, tagNode);
 
-    IDList<TagNode<timeStamps>> &freeList = tagAllocator.getFreeTags();
-    IDList<TagNode<timeStamps>> &usedList = tagAllocator.getUsedTags();
-
-    bool isFoundOnUsedList = usedList.peekContains(*tagNode);
-    bool isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_FALSE(isFoundOnFreeList);
-    EXPECT_TRUE(isFoundOnUsedList);
+    EXPECT_FALSE(tagAllocator.isFreeTag(tagNode));
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
 
     tagAllocator.returnTag(tagNode);
 
-    isFoundOnUsedList = usedList.peekContains(*tagNode);
-    isFoundOnFreeList = freeList.peekContains(*tagNode);
-
-    EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_FALSE(isFoundOnUsedList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(tagNode));
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 }
 
 TEST_F(TagAllocatorTest, TagAlignment) {
@@ -176,25 +185,18 @@ TEST_F(TagAllocatorTest, GetTagsAndReturnInDifferentOrder) {
     EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
     EXPECT_EQ(2u, tagAllocator.getTagPoolCount());
 
-    IDList<TagNode<timeStamps>> &freeList = tagAllocator.getFreeTags();
-    bool isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
-    EXPECT_FALSE(isFoundOnFreeList);
+    EXPECT_FALSE(tagAllocator.isFreeTag(tagNodes[0]));
 
     tagAllocator.returnTag(tagNodes[2]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[2]);
-    EXPECT_TRUE(isFoundOnFreeList);
-    EXPECT_NE(nullptr, tagAllocator.getFreeTagsHead());
+    EXPECT_TRUE(tagAllocator.isFreeTag(tagNodes[2]));
 
     tagAllocator.returnTag(tagNodes[3]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[3]);
-    EXPECT_TRUE(isFoundOnFreeList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(tagNodes[3]));
 
     tagAllocator.returnTag(tagNodes[1]);
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[1]);
-    EXPECT_TRUE(isFoundOnFreeList);
+    EXPECT_TRUE(tagAllocator.isFreeTag(tagNodes[1]));
 
-    isFoundOnFreeList = freeList.peekContains(*tagNodes[0]);
-    EXPECT_FALSE(isFoundOnFreeList);
+    EXPECT_FALSE(tagAllocator.isFreeTag(tagNodes[0]));
 
     tagAllocator.returnTag(tagNodes[0]);
 }
@@ -267,18 +269,18 @@ TEST_F(TagAllocatorTest, givenMultipleReferencesOnTagWhenReleasingThenReturnWhen
     MockTagAllocator tagAllocator(memoryManager, 2, 1);
 
     auto tag = tagAllocator.getTag();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead()); // only 1 reference
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount()); // only 1 reference
 
     tag = tagAllocator.getTag();
     tag->incRefCount();
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount());
 
     tagAllocator.returnTag(tag);
-    EXPECT_NE(nullptr, tagAllocator.getUsedTagsHead()); // 1 reference left
+    EXPECT_EQ(1u, tagAllocator.getUsedTagsCount()); // 1 reference left
     tagAllocator.returnTag(tag);
-    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(0u, tagAllocator.getUsedTagsCount());
 }
 
 TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
@@ -289,7 +291,8 @@ TEST_F(TagAllocatorTest, givenNotReadyTagWhenReturnedThenMoveToDeferredList) {
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
     tagAllocator.returnTag(node);
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
+    EXPECT_EQ(1u, tagAllocator.getStatistics().deferredTags);
 }
 
 TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToFreeList) {
@@ -300,7 +303,7 @@ TEST_F(TagAllocatorTest, givenReadyTagWhenReturnedThenMoveToFreeList) {
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
     tagAllocator.returnTag(node);
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.isFreeTag(node));
 }
 
 TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDeferredListFirst) {
@@ -309,11 +312,13 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
 
     node->tagForCpuAccess->release = false;
     tagAllocator.returnTag(node);
-    node->tagForCpuAccess->release = false;
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
-    node = tagAllocator.getTag();
-    EXPECT_NE(nullptr, node);
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty()); // empty again - new pool wasnt allocated
+    node->tagForCpuAccess->release = true;
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
+    auto newNode = tagAllocator.getTag();
+    EXPECT_EQ(node, newNode);
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount()); // new pool wasnt allocated
+    EXPECT_EQ(0u, tagAllocator.getStatistics().deferredTags);
 }
 
 TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTagsToFreePool) {
@@ -328,17 +333,164 @@ TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTags
 
     tagAllocator.releaseDeferredTags();
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_TRUE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
 
     node1->tagForCpuAccess->release = true;
     tagAllocator.releaseDeferredTags();
     EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.isFreeTag(node1));
 
     node2->tagForCpuAccess->release = true;
     tagAllocator.releaseDeferredTags();
     EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
-    EXPECT_FALSE(tagAllocator.getFreeTags().peekIsEmpty());
+    EXPECT_TRUE(tagAllocator.isFreeTag(node2));
+}
+
+TEST_F(TagAllocatorTest, givenEmptyMagazineWhenAskingForTagThenBatchOfTagsIsMovedFromPool) {
+    auto batchSize = MockTagAllocator::magazineBatchSize;
+    MockTagAllocator tagAllocator(memoryManager, 2 * batchSize, 1);
+    EXPECT_EQ(2 * batchSize, tagAllocator.freeTags.size());
+    EXPECT_EQ(0u, tagAllocator.getStatistics().magazineRefills);
+
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(batchSize, tagAllocator.freeTags.size());
+    EXPECT_EQ(2 * batchSize - 1, tagAllocator.getFreeTagsCount());
+
+    auto statistics = tagAllocator.getStatistics();
+    EXPECT_EQ(2 * batchSize, statistics.poolSize);
+    EXPECT_EQ(1u, statistics.usedTags);
+    EXPECT_EQ(1u, statistics.magazineRefills);
+    EXPECT_EQ(1u, statistics.poolAllocations);
+
+    for (size_t i = 1; i < batchSize; i++) {
+        tagAllocator.getTag();
+    }
+    EXPECT_EQ(1u, tagAllocator.getStatistics().magazineRefills);
+
+    tagAllocator.getTag();
+    EXPECT_EQ(2u, tagAllocator.getStatistics().magazineRefills);
+    EXPECT_TRUE(tagAllocator.freeTags.empty());
+
+    tagAllocator.returnTag(node);
+}
+
+TEST_F(TagAllocatorTest, givenFullMagazineWhenReturningTagThenBatchOfTagsIsMovedBackToPool) {
+    auto batchSize = MockTagAllocator::magazineBatchSize;
+    MockTagAllocator tagAllocator(memoryManager, 2 * batchSize, 1);
+
+    std::vector<TagNode<timeStamps> *> nodes;
+    for (size_t i = 0; i < 2 * batchSize; i++) {
+        nodes.push_back(tagAllocator.getTag());
+    }
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
+
+    for (size_t i = 0; i < 2 * batchSize - 1; i++) {
+        tagAllocator.returnTag(nodes[i]);
+    }
+    EXPECT_TRUE(tagAllocator.freeTags.empty());
+
+    tagAllocator.returnTag(nodes.back());
+    EXPECT_EQ(batchSize, tagAllocator.freeTags.size());
+    EXPECT_EQ(2 * batchSize, tagAllocator.getFreeTagsCount());
+    EXPECT_EQ(0u, tagAllocator.getStatistics().usedTags);
+}
+
+TEST_F(TagAllocatorTest, givenMoreReadyDeferredTagsThanMagazineBatchWhenReleasingThenReclaimStopsAfterBatch) {
+    auto batchSize = MockTagAllocator::magazineBatchSize;
+    MockTagAllocator tagAllocator(memoryManager, 2 * batchSize + 1, 1);
+
+    std::vector<TagNode<timeStamps> *> nodes;
+    for (size_t i = 0; i < 2 * batchSize + 1; i++) {
+        nodes.push_back(tagAllocator.getTag());
+        nodes.back()->tagForCpuAccess->release = false;
+    }
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+    EXPECT_EQ(2 * batchSize + 1, tagAllocator.getStatistics().deferredTags);
+
+    for (auto node : nodes) {
+        node->tagForCpuAccess->release = true;
+    }
+    tagAllocator.releaseDeferredTags();
+    EXPECT_EQ(batchSize, tagAllocator.getFreeTagsCount());
+    EXPECT_EQ(batchSize + 1, tagAllocator.getStatistics().deferredTags);
+}
+
+TEST_F(TagAllocatorTest, givenBusyTagsInFrontOfReadyDeferredTagWhenPoolIsEmptyThenReadyTagIsReclaimedInsteadOfGrowingPool) {
+    auto tagsCount = 5 * MockTagAllocator::magazineBatchSize;
+    MockTagAllocator tagAllocator(memoryManager, tagsCount, 1);
+
+    std::vector<TagNode<timeStamps> *> nodes;
+    for (size_t i = 0; i < tagsCount; i++) {
+        nodes.push_back(tagAllocator.getTag());
+        nodes.back()->tagForCpuAccess->release = false;
+    }
+    for (auto node : nodes) {
+        tagAllocator.returnTag(node);
+    }
+    EXPECT_EQ(0u, tagAllocator.getFreeTagsCount());
+
+    nodes.back()->tagForCpuAccess->release = true;
+    auto node = tagAllocator.getTag();
+    EXPECT_EQ(nodes.back(), node);
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(tagsCount - 1, tagAllocator.getStatistics().deferredTags);
+
+    for (auto deferredNode : nodes) {
+        deferredNode->tagForCpuAccess->release = true;
+    }
+    tagAllocator.returnTag(node);
+}
+
+class MagazineLockCheckingMemoryManager : public MockMemoryManager {
+  public:
+    MagazineLockCheckingMemoryManager(ExecutionEnvironment &executionEnvironment) : MockMemoryManager(executionEnvironment) {}
+
+    GraphicsAllocation *allocateGraphicsMemoryWithProperties(const AllocationProperties &properties) override {
+        if (tagAllocator != nullptr) {
+            auto &magazineLock = tagAllocator->getMagazine().lock;
+            magazineLockedDuringAllocation = !magazineLock.try_lock();
+            if (!magazineLockedDuringAllocation) {
+                magazineLock.unlock();
+            }
+        }
+        return MockMemoryManager::allocateGraphicsMemoryWithProperties(properties);
+    }
+
+    MockTagAllocator *tagAllocator = nullptr;
+    bool magazineLockedDuringAllocation = false;
+};
+
+TEST_F(TagAllocatorTest, givenEmptyPoolWhenAskingForTagThenNewPoolIsAllocatedWithoutHoldingMagazineLock) {
+    MagazineLockCheckingMemoryManager lockCheckingMemoryManager(*executionEnvironment);
+    MockTagAllocator tagAllocator(&lockCheckingMemoryManager, 1, 1);
+    lockCheckingMemoryManager.tagAllocator = &tagAllocator;
+
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_FALSE(lockCheckingMemoryManager.magazineLockedDuringAllocation);
+
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+}
+
+TEST_F(TagAllocatorTest, givenNotReadyTagAtFrontOfDeferredListWhenReleasingThenReadyTagsBehindItAreReclaimed) {
+    MockTagAllocator tagAllocator(memoryManager, 2, 1);
+    auto node1 = tagAllocator.getTag();
+    auto node2 = tagAllocator.getTag();
+
+    node1->tagForCpuAccess->release = false;
+    node2->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node1);
+    tagAllocator.returnTag(node2);
+
+    node2->tagForCpuAccess->release = true;
+    tagAllocator.releaseDeferredTags();
+    EXPECT_TRUE(tagAllocator.isFreeTag(node2));
+    EXPECT_FALSE(tagAllocator.isFreeTag(node1));
+    EXPECT_EQ(node1, tagAllocator.deferredTags.peekHead());
 }
 
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "runtime/utilities/timeline_tracer.h"
+#include "unit_tests/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace OCLRT;
+
+TEST(TimelineRingBufferTest, givenFullBufferWhenRecordIsPushedThenOldestRecordIsOverwritten) {
+    TimelineRingBuffer buffer(2, 7);
+
+    buffer.push({"first", 1, 1, 0, 7, TimelineTrack::Host});
+    buffer.push({"second", 2, 1, 0, 7, TimelineTrack::Host});
+    buffer.push({"third", 3, 1, 0, 7, TimelineTrack::Host});
+
+    std::vector<TimelineRecord> records;
+    buffer.copyRecords(records);
+
+    EXPECT_EQ(3u, buffer.getWrittenCount());
+    ASSERT_EQ(2u, records.size());
+    EXPECT_STREQ("second", records[0].name);
+    EXPECT_STREQ("third", records[1].name);
+}
+
+TEST(TimelineTracerTest, givenRecordsWhenDumpedThenChromeTraceEventsWithMicrosecondTimesAreWritten) {
+    TimelineTracer tracer;
+    tracer.record("clEnqueueNDRangeKernel", TimelineTrack::Host, 1500, 2001, 3);
+    tracer.record("GPU execution", TimelineTrack::Gpu, 1000, 10, 4);
+
+    std::stringstream out;
+    tracer.dump(out);
+    auto trace = out.str();
+
+    EXPECT_NE(std::string::npos, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"Host\"}"));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"name\":\"GPU\"}"));
+
+    auto hostEvent = trace.find("{\"name\":\"clEnqueueNDRangeKernel\",\"ph\":\"X\",\"pid\":0,\"tid\":");
+    ASSERT_NE(std::string::npos, hostEvent);
+    EXPECT_NE(std::string::npos, trace.find("\"ts\":1.500,\"dur\":2.001,\"args\":{\"value\":3}}", hostEvent));
+
+    auto gpuEvent = trace.find("{\"name\":\"GPU execution\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":1.000,\"dur\":0.010,\"args\":{\"value\":4}}");
+    ASSERT_NE(std::string::npos, gpuEvent);
+    EXPECT_LT(gpuEvent, hostEvent);
+    EXPECT_EQ("\n]}\n", trace.substr(trace.size() - 4));
+}
+
+TEST(TimelineTracerTest, givenRecordsFromDifferentThreadsThenEachThreadUsesOwnBuffer) {
+    TimelineTracer tracer;
+    tracer.record("main", TimelineTrack::Host, 0, 1, 0);
+    tracer.record("main", TimelineTrack::Host, 1, 1, 0);
+    EXPECT_EQ(1u, tracer.getThreadBuffersCount());
+
+    std::thread worker([&tracer]() {
+        tracer.record("worker", TimelineTrack::Host, 2, 1, 0);
+    });
+    worker.join();
+    EXPECT_EQ(2u, tracer.getThreadBuffersCount());
+}
+
+TEST(TimelineTracerTest, givenTracingDisabledWhenScopeEndsThenNothingIsRecorded) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableTimelineTrace.set(0);
+
+    auto buffersBefore = TimelineTracer::get().getThreadBuffersCount();
+    {
+        TimelineScope scope("disabled");
+    }
+    EXPECT_EQ(buffersBefore, TimelineTracer::get().getThreadBuffersCount());
+}